@@ -0,0 +1,588 @@
+#include "../game/engine.hpp"
+#include "../game/view.hpp"
+#include "../game/path.hpp"
+#include "../game/virtual-screen.hpp"
+#include "../pointer/array-board.hpp"
+#include "../linked-list/linked-list.hpp"
+#include "../bitboard/bit-board.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <atomic>
+#include <new>
+
+// built with -DBENCH_CURSES (and frame.cpp, -lncurses) the curses display is measured too,
+// drawing into /dev/null
+#ifdef BENCH_CURSES
+#include "../game/frame.hpp"
+#endif
+
+using namespace std;
+
+// Usage: bench [-t ms] [-s seed] [-f] [-j threads] [-c boards]
+// Times the rules of the game on every storage of the board, without any display,
+// then the drawing of the game on every display backend.
+// -t: time spent on each measure (BENCH_MS by default), -s: seed of the boards,
+// -f: always play the games to the end (a game on a big board takes minutes),
+// -j: threads of the parallel hint search (0 by default: one per hardware thread),
+// -c: only solve the boards 0 to boards - 1 of the seed for every size, mode and generator of the game
+
+#define BENCH_MS 200
+#define BENCH_SEED 1
+
+#define NUM_SIZES 7
+int sizes[NUM_SIZES][2] = {{2, 3}, {4, 6}, {6, 8}, {10, 10}, {20, 20}, {50, 50}, {100, 100}};
+
+// the first sizes are the ones of the game
+#define NUM_GAME_SIZES 3
+
+// random pairs of cells tried by the check-paths measure
+#define BENCH_PAIRS 1024
+
+// every heap allocation of the program goes through here to be counted.
+// The size of a block is kept in front of it, so the bytes still allocated are known too
+atomic<long long> allocations(0);
+atomic<long long> heapBytes(0);
+// most bytes allocated at once since ResetHeapPeak
+atomic<long long> heapPeak(0);
+
+// room for the size, keeping the block aligned like new would
+#define BLOCK_HEADER alignof(max_align_t)
+
+void *operator new(size_t size) {
+    allocations++;
+
+    char *block = (char *)malloc(size + BLOCK_HEADER);
+    if (block == NULL) throw bad_alloc();
+
+    *(size_t *)block = size;
+
+    long long bytes = heapBytes += size;
+    long long peak = heapPeak.load();
+    while (bytes > peak && !heapPeak.compare_exchange_weak(peak, bytes)) {}
+
+    return block + BLOCK_HEADER;
+}
+
+void operator delete(void *block) noexcept {
+    if (block == NULL) return;
+
+    char *start = (char *)block - BLOCK_HEADER;
+    heapBytes -= *(size_t *)start;
+
+    free(start);
+}
+
+void operator delete(void *block, size_t) noexcept {
+    operator delete(block);
+}
+
+typedef chrono::steady_clock Clock;
+
+// the peak starts again from what is allocated now, which is returned
+long long ResetHeapPeak() {
+    long long bytes = heapBytes.load();
+    heapPeak = bytes;
+
+    return bytes;
+}
+
+// time left for a measure and what it has counted so far
+struct Measure {
+    const char *name;
+    long long ops = 0;
+    long long allocs = 0;
+    Clock::duration time = Clock::duration::zero();
+
+    // start of the current timed part
+    Clock::time_point start;
+    long long allocStart;
+
+    // bytes allocated when the measure was made, its peak heap is counted from there
+    long long heapBase = ResetHeapPeak();
+};
+
+int benchMs = BENCH_MS;
+bool fullGames = false;
+
+// threads of the find-hint-mt measure, made once for the whole bench
+HintPool hintPool;
+
+void StartTimer(Measure &measure) {
+    measure.allocStart = allocations.load();
+    measure.start = Clock::now();
+}
+
+void StopTimer(Measure &measure, long long ops) {
+    measure.time += Clock::now() - measure.start;
+    measure.allocs += allocations.load() - measure.allocStart;
+    measure.ops += ops;
+}
+
+// keep measuring until the measure took benchMs
+bool KeepGoing(Measure &measure) {
+    return measure.time < chrono::milliseconds(benchMs);
+}
+
+
+void Report(const char *storage, int height, int width, Measure &measure) {
+    long long ops = measure.ops > 0 ? measure.ops : 1;
+    double ns = chrono::duration<double, nano>(measure.time).count() / ops;
+    double allocs = double(measure.allocs) / ops;
+
+    // heap of the measure alone: the most it had allocated at once
+    double heapKB = (heapPeak.load() - measure.heapBase) / 1024.0;
+
+    printf("%-6s %3dx%-3d  %-14s %14.0f ns/op %10.2f allocs/op %10.1f KB heap\n",
+           storage, height, width, measure.name, ns, allocs, heapKB);
+    fflush(stdout);
+}
+
+void ReportRender(const char *display, int height, int width, Measure &measure, double out, const char *unit) {
+    long long ops = measure.ops > 0 ? measure.ops : 1;
+    double ns = chrono::duration<double, nano>(measure.time).count() / ops;
+    double allocs = double(measure.allocs) / ops;
+
+    printf("%-6s %3dx%-3d  %-14s %14.0f ns/op %10.2f allocs/op %10.2f %s/op\n",
+           display, height, width, measure.name, ns, allocs, out / ops, unit);
+    fflush(stdout);
+}
+
+// normal and difficult: the symbols of a solvable board for each mode
+template <class Board>
+void BenchStorage(const char *storage, int height, int width, char *normal, char *difficult, uint64_t seed) {
+    int cards = height * width;
+
+    // Generating a board, symbols and storage
+    {
+        Measure measure;
+        measure.name = "generate";
+
+        do {
+            Board board;
+
+            StartTimer(measure);
+            GenerateBoard(board, height, width, GEN_SOLVABLE, MODE_NORMAL, BoardSeed(seed, measure.ops));
+            DeleteBoard(board);
+            StopTimer(measure, 1);
+        } while (KeepGoing(measure));
+
+        Report(storage, height, width, measure);
+    }
+
+    // Only filling the storage with symbols already made
+    {
+        Measure measure;
+        measure.name = "load";
+
+        do {
+            Board board;
+
+            StartTimer(measure);
+            CreateBoard(board, height, width);
+            LoadSymbols(board, normal);
+            DeleteBoard(board);
+            StopTimer(measure, 1);
+        } while (KeepGoing(measure));
+
+        Report(storage, height, width, measure);
+    }
+
+    // Path checks between random cards of a full board
+    {
+        // made first, so the heap of the board is counted in
+        Measure measure;
+        measure.name = "check-paths";
+
+        Board board;
+        CreateBoard(board, height, width);
+        LoadSymbols(board, normal);
+
+        Occupancy occ;
+        BuildOccupancy(occ, board, height, width);
+
+        mt19937 gen(seed);
+        uniform_int_distribution<int> cellDist(0, cards - 1);
+
+        Pos *pairs = new Pos[BENCH_PAIRS * 2];
+        for (int i = 0; i < BENCH_PAIRS * 2; i++) {
+            int cell = cellDist(gen);
+            pairs[i] = {cell / width, cell % width};
+        }
+
+        Path path;
+        do {
+            StartTimer(measure);
+            for (int i = 0; i < BENCH_PAIRS; i++) {
+                CheckPaths(pairs[i * 2], pairs[i * 2 + 1], board, occ, path);
+            }
+            StopTimer(measure, BENCH_PAIRS);
+        } while (KeepGoing(measure));
+
+        Report(storage, height, width, measure);
+
+        delete [] pairs;
+        DeleteOccupancy(occ);
+        DeleteBoard(board);
+    }
+
+    // Hint on a full board, the index is made from the storage every time
+    {
+        Measure measure;
+        measure.name = "find-hint";
+
+        Board board;
+        CreateBoard(board, height, width);
+        LoadSymbols(board, normal);
+
+        Occupancy occ;
+        BuildOccupancy(occ, board, height, width);
+
+        Path path;
+        do {
+            StartTimer(measure);
+
+            SymbolIndex index;
+            BuildSymbolIndex(index, board, height, width);
+            FindHint(occ, index, path);
+            DeleteSymbolIndex(index);
+
+            StopTimer(measure, 1);
+        } while (KeepGoing(measure));
+
+        Report(storage, height, width, measure);
+
+        // the same on the threads of the pool
+        Measure parallel;
+        parallel.name = "find-hint-mt";
+
+        do {
+            StartTimer(parallel);
+
+            SymbolIndex index;
+            BuildSymbolIndex(index, board, height, width);
+            FindHintParallel(hintPool, occ, index, path);
+            DeleteSymbolIndex(index);
+
+            StopTimer(parallel, 1);
+        } while (KeepGoing(parallel));
+
+        Report(storage, height, width, parallel);
+
+        DeleteOccupancy(occ);
+        DeleteBoard(board);
+    }
+
+    // Removing random cards one by one and sliding their rows until the board is empty
+    {
+        Measure measure;
+        measure.name = "slide";
+
+        mt19937 gen(seed);
+        int *rowLen = new int[height];
+
+        do {
+            Board board;
+            CreateBoard(board, height, width);
+            LoadSymbols(board, difficult);
+
+            Occupancy occ;
+            BuildOccupancy(occ, board, height, width);
+
+            SymbolIndex index;
+            BuildSymbolIndex(index, board, height, width);
+
+            for (int i = 0; i < height; i++) rowLen[i] = width;
+
+            StartTimer(measure);
+            for (int left = cards; left > 0; left--) {
+                int y = gen() % height;
+                while (rowLen[y] == 0) y = (y + 1) % height;
+
+                Pos pos = {y, int(gen() % rowLen[y])};
+                --rowLen[y];
+
+                SetStatus(board.status, pos, STATUS_REMOVED);
+                SetOccupied(occ, pos, false);
+                RemoveFromIndex(index, pos);
+
+                SlideCards(board, occ, index, width, pos);
+            }
+            StopTimer(measure, cards);
+
+            DeleteSymbolIndex(index);
+            DeleteOccupancy(occ);
+            DeleteBoard(board);
+        } while (KeepGoing(measure));
+
+        Report(storage, height, width, measure);
+
+        delete [] rowLen;
+    }
+
+    // Auto-played games on the engine with no listener, always playing the hint until there is none.
+    // The setup of a game (LoadGame: index, MoveSet...) is its own measure, an op is one game.
+    // Then an op is one move played, the game is cut once the time is up unless fullGames
+    for (int mode = MODE_NORMAL; mode <= MODE_DIFFICULT; mode++) {
+        Measure setup;
+        setup.name = mode == MODE_NORMAL ? "setup-normal" : "setup-difficult";
+
+        Measure measure;
+        measure.name = mode == MODE_NORMAL ? "game-normal" : "game-difficult";
+
+        Pos pair[2];
+        Path path;
+        do {
+            Game<Board> game;
+
+            StartTimer(setup);
+            LoadGame(game, height, width, mode, mode == MODE_NORMAL ? normal : difficult);
+            StopTimer(setup, 1);
+
+            while ((fullGames || KeepGoing(measure)) && GetHint(game, pair, path)) {
+                StartTimer(measure);
+                RemovePair(game, pair);
+                StopTimer(measure, 1);
+            }
+
+            DeleteGame(game);
+        } while (KeepGoing(measure) && KeepGoing(setup)); // a board with no move would never end the moves
+
+        Report(storage, height, width, setup);
+        Report(storage, height, width, measure);
+    }
+}
+
+#define DISPLAY_NULL 0
+#define DISPLAY_VIRTUAL 1
+#define DISPLAY_CURSES 2
+
+// events of a move, kept to be drawn after
+struct EventLog {
+    GameEvent *events;
+    int count = 0;
+};
+
+void LogGameEvent(GameEvent &event, void *data) {
+    EventLog &log = *(EventLog *)data;
+    log.events[log.count++] = event;
+}
+
+// Auto-played difficult games drawn on a display backend. An op is one move drawn like the game does:
+// pair highlighted, its path, the pair removed and the frame painted again.
+// The rules of the move aren't timed (that's the game measures above), only the drawing of its events.
+// The first drawing of the board is counted in
+void BenchRender(int display, int height, int width, char *symbols) {
+    // room around the board for the paths going out of it
+    int screenHeight = height * (CARD_HEIGHT + CARD_SPACE / 2) + CARD_HEIGHT * 2;
+    int screenWidth = width * (CARD_WIDTH + CARD_SPACE) + CARD_WIDTH * 2;
+
+    const char *name = display == DISPLAY_NULL ? "null" : display == DISPLAY_VIRTUAL ? "screen" : "curses";
+
+    // what reached the screen: cells changed for the virtual one, bytes for curses
+    double out = 0;
+    const char *unit = display == DISPLAY_CURSES ? "bytes" : "cells";
+
+#ifdef BENCH_CURSES
+    SCREEN *screen = NULL;
+    FILE *devNull = NULL;
+
+    if (display == DISPLAY_CURSES) {
+        // ncurses takes the size of the screen from there
+        setenv("LINES", to_string(screenHeight).c_str(), 1);
+        setenv("COLUMNS", to_string(screenWidth).c_str(), 1);
+
+        devNull = fopen("/dev/null", "w+");
+        screen = newterm("xterm", devNull, devNull);
+        if (screen == NULL) return;
+
+        start_color();
+        init_pair(1, COLOR_CYAN, COLOR_WHITE);
+        init_pair(2, COLOR_CYAN, COLOR_BLACK);
+    }
+#else
+    if (display == DISPLAY_CURSES) return;
+#endif
+
+    Measure measure;
+    measure.name = "render";
+
+    Pos pair[2];
+    Path path;
+
+    // 2 cards removed, then at most a row slid for each
+    EventLog log;
+    log.events = new GameEvent[2 + 2 * (width + 1)];
+
+    do {
+        Game<ArrayBoard> game;
+        LoadGame(game, height, width, MODE_DIFFICULT, symbols);
+
+#ifdef BENCH_CURSES
+        long long written = BytesWritten();
+#endif
+        StartTimer(measure);
+
+        BoardView view;
+        CreateBoardView(view, height, width, screenHeight, screenWidth);
+
+        if (display == DISPLAY_NULL) UseNullDisplay(view.display);
+        if (display == DISPLAY_VIRTUAL) CreateVirtualScreen(view.display, view);
+#ifdef BENCH_CURSES
+        if (display == DISPLAY_CURSES) CreateCursesDisplay(view.display, view, NULL);
+#endif
+
+        for (int i = 0; i < height; i++) {
+            for (int j = 0; j < width; j++) DisplayCard(view, {i, j}, GetSymbol(game.board, {i, j}));
+        }
+
+        DrawFrame(view);
+        EndFrame(view, "start");
+
+        StopTimer(measure, 0);
+
+        Subscribe(game, LogGameEvent, &log);
+
+        while ((fullGames || KeepGoing(measure)) && GetHint(game, pair, path)) {
+            log.count = 0;
+            ToggleCard(game, pair[0]);
+            ToggleCard(game, pair[1]);
+
+            StartTimer(measure);
+
+            for (int i = 0; i < log.count; i++) DrawGameEvent(log.events[i], &view);
+            EndFrame(view, "hint");
+
+            // no animation here (anims.ms is 0), the path is erased by the next frame
+            AnimatePath(view, height, width, path);
+            EndFrame(view, "path");
+
+            StopTimer(measure, 0);
+
+            log.count = 0;
+            RemovePair(game, pair);
+
+            StartTimer(measure);
+
+            for (int i = 0; i < log.count; i++) DrawGameEvent(log.events[i], &view);
+            DrawFrame(view);
+            EndFrame(view, "input");
+
+            StopTimer(measure, 1);
+        }
+
+        if (display == DISPLAY_VIRTUAL) out += GetVirtualScreen(view.display).stats.cellsChanged;
+#ifdef BENCH_CURSES
+        if (display == DISPLAY_CURSES) out += BytesWritten() - written;
+#endif
+
+        DeleteBoardView(view);
+        DeleteGame(game);
+    } while (KeepGoing(measure));
+
+    delete [] log.events;
+
+    ReportRender(name, height, width, measure, out, unit);
+
+#ifdef BENCH_CURSES
+    if (screen) {
+        endwin();
+        delscreen(screen);
+        fclose(devNull);
+    }
+#endif
+}
+
+// Solve the boards the game would serve for a seed (boards 0 to boards - 1, like the -n option of the game)
+// and count how they end: cleared, stuck or given up by the solver
+void CheckBoards(uint64_t seed, int boards) {
+    const char *generators[] = {"classic", "solvable"};
+    const char *modes[] = {"normal", "difficult"};
+
+    for (int i = 0; i < NUM_GAME_SIZES; i++) {
+        int height = sizes[i][0];
+        int width = sizes[i][1];
+
+        char *symbols = new char[height * width];
+        Move *solution = new Move[height * width / 2];
+
+        for (int generator = GEN_CLASSIC; generator <= GEN_SOLVABLE; generator++) {
+            for (int mode = MODE_NORMAL; mode <= MODE_DIFFICULT; mode++) {
+                int results[3] = {0, 0, 0};
+                double totalMs = 0, maxMs = 0;
+
+                for (int n = 0; n < boards; n++) {
+                    GenerateSymbols(symbols, height, width, generator, mode, BoardSeed(seed, n));
+
+                    Clock::time_point start = Clock::now();
+
+                    int solutionLen;
+                    int result = SolveBoard(symbols, height, width, mode == MODE_DIFFICULT, solution, solutionLen);
+
+                    double ms = chrono::duration<double, milli>(Clock::now() - start).count();
+                    totalMs += ms;
+                    maxMs = max(maxMs, ms);
+
+                    ++results[result];
+                }
+
+                printf("%3dx%-3d %-8s %-9s %6d cleared %6d stuck %6d gave-up %10.2f ms avg %10.2f ms max\n",
+                       height, width, generators[generator], modes[mode], results[SOLVE_CLEARED],
+                       results[SOLVE_STUCK], results[SOLVE_GAVE_UP], totalMs / boards, maxMs);
+                fflush(stdout);
+            }
+        }
+
+        delete [] symbols;
+        delete [] solution;
+    }
+}
+
+int main(int argc, char **argv) {
+    uint64_t seed = BENCH_SEED;
+    int checkBoards = 0;
+    int hintThreads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) benchMs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) seed = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-f") == 0) fullGames = true;
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) hintThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) checkBoards = atoi(argv[++i]);
+    }
+
+    if (checkBoards > 0) {
+        CheckBoards(seed, checkBoards);
+        return 0;
+    }
+
+    CreateHintPool(hintPool, hintThreads);
+
+    for (int i = 0; i < NUM_SIZES; i++) {
+        int height = sizes[i][0];
+        int width = sizes[i][1];
+
+        // the same boards for every storage, made once since the big difficult ones are slow to build
+        char *normal = new char[height * width];
+        char *difficult = new char[height * width];
+        GenerateSymbols(normal, height, width, GEN_SOLVABLE, MODE_NORMAL, BoardSeed(seed, 0));
+        GenerateSymbols(difficult, height, width, GEN_SOLVABLE, MODE_DIFFICULT, BoardSeed(seed, 0));
+
+        BenchStorage<ArrayBoard>("array", height, width, normal, difficult, seed);
+        BenchStorage<ListBoard>("list", height, width, normal, difficult, seed);
+        BenchStorage<BitBoard>("bits", height, width, normal, difficult, seed);
+
+        BenchRender(DISPLAY_NULL, height, width, difficult);
+        BenchRender(DISPLAY_VIRTUAL, height, width, difficult);
+        BenchRender(DISPLAY_CURSES, height, width, difficult);
+
+        delete [] normal;
+        delete [] difficult;
+    }
+
+    DeleteHintPool(hintPool);
+
+    return 0;
+}
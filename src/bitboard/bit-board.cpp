@@ -0,0 +1,62 @@
+#include "bit-board.hpp"
+
+using namespace std;
+
+void CreateBoard(BitBoard &board, int height, int width) {
+    board.height = height;
+    board.width = width;
+    board.rowWords = (width + SYMBOLS_PER_WORD - 1) / SYMBOLS_PER_WORD;
+    board.words = new uint64_t[height * board.rowWords]();
+    CreateStatusBits(board.status, height, width);
+}
+
+void DeleteBoard(BitBoard &board) {
+    delete [] board.words;
+    DeleteStatusBits(board.status);
+
+    board.words = NULL;
+    board.height = board.width = board.rowWords = 0;
+}
+
+void LoadSymbols(BitBoard &board, char *symbols) {
+    for (int i = 0; i < board.height; i++) {
+        uint64_t *row = board.words + i * board.rowWords;
+
+        for (int j = 0; j < board.width; j++) {
+            row[j / SYMBOLS_PER_WORD] |= uint64_t(uint8_t(symbols[i * board.width + j])) << (j % SYMBOLS_PER_WORD * 8);
+        }
+    }
+}
+
+void GetSymbols(BitBoard &board, char *symbols) {
+    for (int i = 0; i < board.height; i++) {
+        for (int j = 0; j < board.width; j++) {
+            bool removed = GetStatus(board.status, {i, j}) == STATUS_REMOVED;
+            symbols[i * board.width + j] = removed ? EMPTY_SYMBOL : GetSymbol(board, {i, j});
+        }
+    }
+}
+
+char GetSymbol(BitBoard &board, Pos pos) {
+    uint64_t word = board.words[pos.y * board.rowWords + pos.x / SYMBOLS_PER_WORD];
+
+    return char(word >> (pos.x % SYMBOLS_PER_WORD * 8));
+}
+
+void SlideSymbols(BitBoard &board, Pos removedPos, int lastX) {
+    uint64_t *row = board.words + removedPos.y * board.rowWords;
+    int first = removedPos.x / SYMBOLS_PER_WORD;
+    int last = lastX / SYMBOLS_PER_WORD;
+    int shift = removedPos.x % SYMBOLS_PER_WORD * 8;
+
+    // in the first word only the symbols above the removed one move
+    uint64_t below = shift ? row[first] & ((1ULL << shift) - 1) : 0;
+    uint64_t above = shift < 56 ? row[first] >> (shift + 8) << shift : 0;
+    row[first] = below | above;
+
+    // every word takes the lowest symbol of the next one as its highest
+    for (int k = first; k < last; k++) {
+        row[k] |= row[k + 1] << 56;
+        row[k + 1] >>= 8;
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../core/pos.hpp"
+#include "../core/status-bits.hpp"
+#include "../core/symbol-index.hpp"
+
+#include <cstdint>
+
+// symbols held by one word of a row
+#define SYMBOLS_PER_WORD 8
+
+// All the cards of a game with their symbols packed 8 to a 64 bit word, every row starting
+// on a new word. Sliding a row is a few word shifts instead of moving the cards one by one
+struct BitBoard {
+    int height = 0, width = 0;
+
+    // words taken by one row
+    int rowWords = 0;
+    uint64_t *words = NULL;
+
+    StatusBits status;
+};
+
+void CreateBoard(BitBoard &board, int height, int width);
+void DeleteBoard(BitBoard &board);
+
+void LoadSymbols(BitBoard &board, char *symbols);
+void GetSymbols(BitBoard &board, char *symbols);
+
+char GetSymbol(BitBoard &board, Pos pos);
+
+void SlideSymbols(BitBoard &board, Pos removedPos, int lastX);
@@ -0,0 +1,7 @@
+#include "bit-board.hpp"
+#include "../game/play.hpp"
+
+// the bitboard build keeps the symbols packed in 64 bit words
+int PlayGame(int height, int width, int mode, int generator, uint64_t seed, uint64_t boardNum, int &timeFinished) {
+    return PlayBoard<BitBoard>(height, width, mode, generator, seed, boardNum, timeFinished);
+}
@@ -0,0 +1,172 @@
+#include "generator.hpp"
+
+#include <algorithm>
+
+using namespace std;
+
+/*
+The board is built from empty to full, the cards of every row stay packed on its left.
+A slot is where the next card of a row can go:
+- normal mode: right after the last card of the row. The cells on the right of the last
+  cards are all empty, so 2 such cards are always connected through the column outside
+  the board on the right (or next to each other in the same row).
+- difficult mode: a removed card is filled by the ones on its right, so the rows are always
+  packed on the left while playing. A card can be inserted anywhere in a row, the cards on
+  its right move one cell to the right.
+A pair is kept when its cards are connected on the board holding it, which is the board
+it will be removed from.
+*/
+struct BoardBuilder {
+    int height, width;
+    bool slide;
+
+    Occupancy occ;
+
+    // pair of the card in each cell, -1 for an empty cell
+    int *pairOf;
+
+    // number of cards of each row
+    int *rowLen;
+};
+
+int CountSlots(BoardBuilder &builder) {
+    int slots = 0;
+    for (int i = 0; i < builder.height; i++) {
+        if (builder.rowLen[i] < builder.width) slots += builder.slide ? builder.rowLen[i] + 1 : 1;
+    }
+    return slots;
+}
+
+Pos GetSlot(BoardBuilder &builder, int k) {
+    for (int i = 0; i < builder.height; i++) {
+        if (builder.rowLen[i] == builder.width) continue;
+
+        if (!builder.slide) {
+            if (k == 0) return {i, builder.rowLen[i]};
+            --k;
+            continue;
+        }
+
+        if (k <= builder.rowLen[i]) return {i, k};
+        k -= builder.rowLen[i] + 1;
+    }
+    return {-1, -1};
+}
+
+// put a card of pair at slot, the cards on its right move one cell to the right
+void InsertCard(BoardBuilder &builder, Pos slot, int pair) {
+    int *row = builder.pairOf + slot.y * builder.width;
+
+    for (int x = builder.rowLen[slot.y]; x > slot.x; x--) row[x] = row[x - 1];
+    row[slot.x] = pair;
+
+    // the row gets one more card at its end
+    SetOccupied(builder.occ, {slot.y, builder.rowLen[slot.y]++}, true);
+}
+
+// undo InsertCard, the card is at pos
+void RemoveCard(BoardBuilder &builder, Pos pos) {
+    int *row = builder.pairOf + pos.y * builder.width;
+
+    int len = --builder.rowLen[pos.y];
+    for (int x = pos.x; x < len; x++) row[x] = row[x + 1];
+    row[len] = -1;
+
+    SetOccupied(builder.occ, {pos.y, len}, false);
+}
+
+bool Connects(Pos p1, Pos p2, Occupancy &occ) {
+    Pos path[MAX_TURNS + 2];
+    int pathLen;
+    return FindPath(p1, p2, occ, path, pathLen);
+}
+
+// Place the next pair on cells connected on the board holding it.
+// The first card goes to a random slot, the second one to random slots, then to every slot,
+// before moving the first card to the next slot.
+bool PlacePair(BoardBuilder &builder, int pair, mt19937 &gen) {
+    int slots = CountSlots(builder);
+    int firstStart = uniform_int_distribution<int>(0, slots - 1)(gen);
+
+    for (int i = 0; i < slots; i++) {
+        Pos posA = GetSlot(builder, (firstStart + i) % slots);
+        InsertCard(builder, posA, pair);
+
+        int slotsLeft = CountSlots(builder);
+        uniform_int_distribution<int> slotDist(0, slotsLeft - 1);
+        int secondStart = slotDist(gen);
+
+        for (int j = 0; j < GEN_SAMPLE_TRIES + slotsLeft; j++) {
+            int k = j < GEN_SAMPLE_TRIES ? slotDist(gen) : (secondStart + j - GEN_SAMPLE_TRIES) % slotsLeft;
+
+            Pos posB = GetSlot(builder, k);
+            InsertCard(builder, posB, pair);
+
+            // inserting B before A in the same row pushed A to the right
+            Pos cardA = posA;
+            if (posB.y == posA.y && posB.x <= posA.x) ++cardA.x;
+
+            if (Connects(cardA, posB, builder.occ)) return true;
+
+            RemoveCard(builder, posB);
+        }
+
+        RemoveCard(builder, posA);
+    }
+
+    return false;
+}
+
+bool GenerateSolvable(char *symbols, int height, int width, bool slide, mt19937 &gen) {
+    int totalCells = height * width;
+    int totalPairs = totalCells / 2;
+
+    // a card would be left without a pair
+    if (height <= 0 || width <= 0 || totalCells % 2 != 0) return false;
+
+    BoardBuilder builder;
+    builder.height = height;
+    builder.width = width;
+    builder.slide = slide;
+    builder.pairOf = new int[totalCells];
+    builder.rowLen = new int[height];
+
+    bool built = false;
+    for (int restart = 0; restart <= GEN_MAX_RESTARTS && !built; restart++) {
+        CreateOccupancy(builder.occ, height, width);
+        for (int i = 0; i < totalCells; i++) builder.pairOf[i] = -1;
+        for (int i = 0; i < height; i++) builder.rowLen[i] = 0;
+
+        built = true;
+        for (int pair = 0; pair < totalPairs && built; pair++) {
+            built = PlacePair(builder, pair, gen);
+        }
+
+        DeleteOccupancy(builder.occ);
+    }
+
+    if (built) {
+        // one letter per pair, the letters come back in a shuffled order on big boards
+        char letters[26];
+        for (int i = 0; i < 26; i++) letters[i] = 'A' + i;
+        shuffle(letters, letters + 26, gen);
+
+        // the rules are the same upside down, and mirrored too when nothing slides
+        bool flipRows = gen() % 2;
+        bool flipCols = !slide && gen() % 2;
+
+        for (int i = 0; i < height; i++) {
+            for (int j = 0; j < width; j++) {
+                int y = flipRows ? height - 1 - i : i;
+                int x = flipCols ? width - 1 - j : j;
+
+                symbols[y * width + x] = letters[builder.pairOf[i * width + j] % 26];
+            }
+        }
+    }
+
+    delete [] builder.pairOf;
+    delete [] builder.rowLen;
+
+    return built;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "pos.hpp"
+#include "occupancy.hpp"
+#include "pathfinder.hpp"
+
+#include <random>
+
+// Board generators
+#define GEN_CLASSIC 0  // random pairs, may have no solution
+#define GEN_SOLVABLE 1 // built backwards from a removal order, always has one
+
+// random cells tried for the second card of a pair before going through all of them
+#define GEN_SAMPLE_TRIES 16
+
+// times a board is started over when the construction gets stuck
+#define GEN_MAX_RESTARTS 20
+
+// Fill symbols (height * width symbols row by row) with a board that can be cleared.
+// The pairs are placed in the reverse order of their removal, each one on cells connected
+// on the board it is removed from, so playing them backwards clears the board.
+// slide: build it for the difficult mode rules (SlideBoard).
+// Returns false if the construction kept getting stuck, or if height * width is odd.
+bool GenerateSolvable(char *symbols, int height, int width, bool slide, std::mt19937 &gen);
@@ -0,0 +1,262 @@
+#include "move-set.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+// Cards that slid in a turn: row y from x1 to the end of the row
+struct Span {
+    int y, x1;
+};
+
+bool IsInSpans(Pos pos, Span *spans, int spanCount) {
+    for (int i = 0; i < spanCount; i++) {
+        if (pos.y == spans[i].y && spans[i].x1 <= pos.x) return true;
+    }
+    return false;
+}
+
+// Cells left empty by a turn: the removed cells, or in difficult mode the end of the slid rows.
+// Rows slide from the removed cells, so the cells freed in a row are its first empty cells from the leftmost removed one
+int GetFreedCells(Pos *freed, Span *spans, int &spanCount, Occupancy &occ, Pos *removed, int removedLen, bool slided) {
+    spanCount = 0;
+
+    if (!slided) {
+        for (int i = 0; i < removedLen; i++) freed[i] = removed[i];
+        return removedLen;
+    }
+
+    int count = 0;
+    for (int i = 0; i < removedLen; i++) {
+        // one span for the cards removed in the same row
+        bool done = false;
+        for (int j = 0; j < spanCount; j++) done = done || spans[j].y == removed[i].y;
+        if (done) continue;
+
+        Span span = {removed[i].y, removed[i].x};
+        int cards = 0;
+        for (int j = 0; j < removedLen; j++) {
+            if (removed[j].y != span.y) continue;
+
+            span.x1 = min(span.x1, removed[j].x);
+            ++cards;
+        }
+
+        spans[spanCount++] = span;
+
+        for (int x = span.x1; x < occ.width && cards > 0; x++) {
+            if (IsOccupied(occ, {span.y, x})) continue;
+
+            freed[count++] = {span.y, x};
+            --cards;
+        }
+    }
+
+    return count;
+}
+
+// Free cells around a card along its row and its column, the card included.
+// A line that reaches the border goes one cell out of the board, like the paths
+struct Reach {
+    int left, right, top, bottom;
+};
+
+Reach GetReach(Occupancy &occ, Pos pos) {
+    Reach reach;
+
+    int left = pos.x > 0 ? PrevInRow(occ, pos.y, pos.x - 1) : -1;
+    int right = pos.x < occ.width - 1 ? NextInRow(occ, pos.y, pos.x + 1) : occ.width;
+    int top = pos.y > 0 ? PrevInCol(occ, pos.x, pos.y - 1) : -1;
+    int bottom = pos.y < occ.height - 1 ? NextInCol(occ, pos.x, pos.y + 1) : occ.height;
+
+    reach.left = left == -1 ? -1 : left + 1;
+    reach.right = right == occ.width ? occ.width : right - 1;
+    reach.top = top == -1 ? -1 : top + 1;
+    reach.bottom = bottom == occ.height ? occ.height : bottom - 1;
+
+    return reach;
+}
+
+// Only for MAX_TURNS 2 (UpdateMoveSet builds the set again otherwise):
+// every cell of a path with at most 2 turns is on a line from a card (reached by it)
+// or on the middle line, whose ends are reached by both cards: on the same row (both columns reach it)
+// or on the same column (both rows reach it). So a path can only go through cell if:
+#define REACH_CARD 1 // the card reaches cell, paired with any card
+#define REACH_ROW 2  // the column of the card reaches the row of cell, paired with the same
+#define REACH_COL 4  // the row of the card reaches the column of cell, paired with the same
+
+int GetReachFlags(Pos pos, Reach &reach, Pos cell) {
+    int flags = 0;
+
+    bool rowInReach = reach.top <= cell.y && cell.y <= reach.bottom;
+    bool colInReach = reach.left <= cell.x && cell.x <= reach.right;
+
+    if (rowInReach) flags |= REACH_ROW;
+    if (colInReach) flags |= REACH_COL;
+
+    if ((pos.y == cell.y && colInReach) || (pos.x == cell.x && rowInReach)) flags |= REACH_CARD;
+
+    return flags;
+}
+
+// make room for at least size moves, keeping the ones in the set
+void ReserveMoves(MoveSet &moves, int size) {
+    if (size <= moves.capacity) return;
+
+    int capacity = max(size, moves.capacity * 2);
+    Move *grown = new Move[capacity];
+    for (int i = 0; i < moves.count; i++) grown[i] = moves.moves[i];
+
+    delete [] moves.moves;
+    moves.moves = grown;
+    moves.capacity = capacity;
+}
+
+void AddMove(MoveSet &moves, Pos p1, Pos p2) {
+    if (moves.count == moves.capacity) ReserveMoves(moves, moves.count + 1);
+    moves.moves[moves.count++] = {p1, p2};
+}
+
+void BuildMoveSet(MoveSet &moves, Occupancy &occ, SymbolIndex &index) {
+    moves.capacity = 0;
+    for (int s = 0; s < NUM_SYMBOLS; s++) {
+        moves.capacity += index.count[s] * (index.count[s] - 1) / 2;
+    }
+
+    moves.moves = new Move[moves.capacity];
+    moves.count = 0;
+
+    Pos path[MAX_TURNS + 2];
+    int pathLen;
+
+    for (int s = 0; s < NUM_SYMBOLS; s++) {
+        Pos *cards = index.cells + index.start[s];
+
+        for (int i = 0; i < index.count[s] - 1; i++) {
+            for (int j = i + 1; j < index.count[s]; j++) {
+                if (FindPath(cards[i], cards[j], occ, path, pathLen)) AddMove(moves, cards[i], cards[j]);
+            }
+        }
+    }
+}
+
+void DeleteMoveSet(MoveSet &moves) {
+    delete [] moves.moves;
+
+    moves.moves = NULL;
+    moves.count = moves.capacity = 0;
+}
+
+void CopyMoveSet(MoveSet &dst, MoveSet &src) {
+    dst.count = 0;
+    ReserveMoves(dst, src.count);
+
+    for (int i = 0; i < src.count; i++) dst.moves[i] = src.moves[i];
+    dst.count = src.count;
+}
+
+// pair of slots of the index, the lower one first
+long long PairKey(int slot1, int slot2, int totalCells) {
+    if (slot1 > slot2) swap(slot1, slot2);
+    return (long long)slot1 * totalCells + slot2;
+}
+
+void UpdateMoveSet(MoveSet &moves, Occupancy &occ, SymbolIndex &index, Pos *removed, int removedLen, bool slided) {
+    // the reach of the cards below only holds for paths of 2 turns,
+    // with a longer MAX_TURNS every pair is checked again
+    if (MAX_TURNS != 2) {
+        DeleteMoveSet(moves);
+        BuildMoveSet(moves, occ, index);
+        return;
+    }
+
+    int totalCells = occ.height * occ.width;
+
+    // Cards only leave the board (slid cards fill cells that had a card before the turn),
+    // so every path still there is still free: only the cells freed can make new paths
+    Pos freed[2 * 2];
+    Span spans[2 * 2];
+    int spanCount;
+    int freedCount = GetFreedCells(freed, spans, spanCount, occ, removed, removedLen, slided);
+
+    // Pairs that may have a new path: through a freed cell, or from a card that slid.
+    // They're found from the cards of each symbol reaching the freed cells,
+    // every other pair of the board is left alone
+    vector<long long> candidates;
+
+    int *reachFlags = new int[totalCells];
+    int *rowCards = new int[totalCells];
+    int *colCards = new int[totalCells];
+
+    for (int s = 0; s < NUM_SYMBOLS; s++) {
+        int count = index.count[s];
+        if (count < 2) continue;
+
+        int start = index.start[s];
+        Pos *cards = index.cells + start;
+
+        for (int i = 0; i < count; i++) {
+            Reach reach = GetReach(occ, cards[i]);
+
+            reachFlags[i] = 0;
+            for (int k = 0; k < freedCount; k++) reachFlags[i] |= GetReachFlags(cards[i], reach, freed[k]);
+
+            // cards that slid have moved, all of their pairs are new
+            if (IsInSpans(cards[i], spans, spanCount)) reachFlags[i] |= REACH_CARD;
+        }
+
+        int rowCount = 0, colCount = 0;
+        for (int i = 0; i < count; i++) {
+            if (reachFlags[i] & REACH_CARD) {
+                for (int j = 0; j < count; j++) {
+                    if (j != i) candidates.push_back(PairKey(start + i, start + j, totalCells));
+                }
+            }
+
+            if (reachFlags[i] & REACH_ROW) rowCards[rowCount++] = i;
+            if (reachFlags[i] & REACH_COL) colCards[colCount++] = i;
+        }
+
+        for (int i = 0; i < rowCount; i++) {
+            for (int j = i + 1; j < rowCount; j++) candidates.push_back(PairKey(start + rowCards[i], start + rowCards[j], totalCells));
+        }
+
+        for (int i = 0; i < colCount; i++) {
+            for (int j = i + 1; j < colCount; j++) candidates.push_back(PairKey(start + colCards[i], start + colCards[j], totalCells));
+        }
+    }
+
+    delete [] reachFlags;
+    delete [] rowCards;
+    delete [] colCards;
+
+    sort(candidates.begin(), candidates.end());
+    candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+
+    // Moves of the set: the removed and slid cards go, the candidates are checked again below
+    int kept = 0;
+    for (int i = 0; i < moves.count; i++) {
+        Move &move = moves.moves[i];
+
+        int slot1 = index.slot[move.p1.y * occ.width + move.p1.x];
+        int slot2 = index.slot[move.p2.y * occ.width + move.p2.x];
+        if (slot1 == -1 || slot2 == -1) continue;
+
+        if (IsInSpans(move.p1, spans, spanCount) || IsInSpans(move.p2, spans, spanCount)) continue;
+        if (binary_search(candidates.begin(), candidates.end(), PairKey(slot1, slot2, totalCells))) continue;
+
+        moves.moves[kept++] = move;
+    }
+    moves.count = kept;
+
+    Pos path[MAX_TURNS + 2];
+    int pathLen;
+
+    for (long long key : candidates) {
+        Pos p1 = index.cells[key / totalCells];
+        Pos p2 = index.cells[key % totalCells];
+
+        if (FindPath(p1, p2, occ, path, pathLen)) AddMove(moves, p1, p2);
+    }
+}
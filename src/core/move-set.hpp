@@ -0,0 +1,37 @@
+#pragma once
+
+#include "pos.hpp"
+#include "occupancy.hpp"
+#include "symbol-index.hpp"
+#include "pathfinder.hpp"
+
+#include <cstddef>
+
+// A pair of cards that can be connected right now
+struct Move {
+    Pos p1, p2;
+};
+
+// Every move available on the board, kept up to date after each turn
+// so asking for a hint or checking for the end of the game costs nothing
+struct MoveSet {
+    Move *moves = NULL;
+    int count = 0;
+
+    // room in moves, grows when a move doesn't fit
+    // (never past the number of pairs of cards with the same symbol)
+    int capacity = 0;
+};
+
+void BuildMoveSet(MoveSet &moves, Occupancy &occ, SymbolIndex &index);
+void DeleteMoveSet(MoveSet &moves);
+
+// make dst the same set as src
+void CopyMoveSet(MoveSet &dst, MoveSet &src);
+
+// Update the set once the turn is over (occupancy and index already updated).
+// removed: cells of the cards that just left the board,
+// slided: the cards on their right slid to the left to fill them (difficult mode).
+// Only the pairs around the freed cells are checked again, which holds for paths of 2 turns:
+// with another MAX_TURNS the whole set is built again
+void UpdateMoveSet(MoveSet &moves, Occupancy &occ, SymbolIndex &index, Pos *removed, int removedLen, bool slided);
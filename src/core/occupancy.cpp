@@ -0,0 +1,111 @@
+#include "occupancy.hpp"
+
+using namespace std;
+
+#define WORD_BITS 64
+
+// first set bit of a line at or after index from, size if there is none
+int NextBit(uint64_t *line, int words, int size, int from) {
+    if (from >= size) return size;
+    if (from < 0) from = 0;
+
+    int w = from / WORD_BITS;
+    // drop the bits before from
+    uint64_t bits = line[w] & (~0ULL << (from % WORD_BITS));
+
+    while (!bits) {
+        if (++w == words) return size;
+        bits = line[w];
+    }
+
+    return w * WORD_BITS + __builtin_ctzll(bits);
+}
+
+// last set bit of a line at or before index from, -1 if there is none
+int PrevBit(uint64_t *line, int size, int from) {
+    if (from < 0) return -1;
+    if (from >= size) from = size - 1;
+
+    int w = from / WORD_BITS;
+    // drop the bits after from
+    int shift = WORD_BITS - 1 - from % WORD_BITS;
+    uint64_t bits = line[w] & (~0ULL >> shift);
+
+    while (!bits) {
+        if (--w < 0) return -1;
+        bits = line[w];
+    }
+
+    return w * WORD_BITS + WORD_BITS - 1 - __builtin_clzll(bits);
+}
+
+void CreateOccupancy(Occupancy &occ, int height, int width) {
+    occ.height = height;
+    occ.width = width;
+    occ.rowWords = (width + WORD_BITS - 1) / WORD_BITS;
+    occ.colWords = (height + WORD_BITS - 1) / WORD_BITS;
+
+    occ.rows = new uint64_t[height * occ.rowWords]();
+    occ.cols = new uint64_t[width * occ.colWords]();
+}
+
+void DeleteOccupancy(Occupancy &occ) {
+    delete [] occ.rows;
+    delete [] occ.cols;
+
+    occ.rows = occ.cols = NULL;
+    occ.height = occ.width = 0;
+}
+
+void CopyOccupancy(Occupancy &dst, Occupancy &src) {
+    if (dst.rows == NULL) CreateOccupancy(dst, src.height, src.width);
+
+    for (int i = 0; i < src.height * src.rowWords; i++) dst.rows[i] = src.rows[i];
+    for (int i = 0; i < src.width * src.colWords; i++) dst.cols[i] = src.cols[i];
+}
+
+bool IsOccupied(Occupancy &occ, Pos pos) {
+    uint64_t word = occ.rows[pos.y * occ.rowWords + pos.x / WORD_BITS];
+    return (word >> (pos.x % WORD_BITS)) & 1;
+}
+
+void SetOccupied(Occupancy &occ, Pos pos, bool occupied) {
+    uint64_t &rowWord = occ.rows[pos.y * occ.rowWords + pos.x / WORD_BITS];
+    uint64_t &colWord = occ.cols[pos.x * occ.colWords + pos.y / WORD_BITS];
+    uint64_t rowBit = 1ULL << (pos.x % WORD_BITS);
+    uint64_t colBit = 1ULL << (pos.y % WORD_BITS);
+
+    if (occupied) {
+        rowWord |= rowBit;
+        colWord |= colBit;
+    } else {
+        rowWord &= ~rowBit;
+        colWord &= ~colBit;
+    }
+}
+
+int NextInRow(Occupancy &occ, int y, int x) {
+    return NextBit(occ.rows + y * occ.rowWords, occ.rowWords, occ.width, x);
+}
+
+int PrevInRow(Occupancy &occ, int y, int x) {
+    return PrevBit(occ.rows + y * occ.rowWords, occ.width, x);
+}
+
+int NextInCol(Occupancy &occ, int x, int y) {
+    return NextBit(occ.cols + x * occ.colWords, occ.colWords, occ.height, y);
+}
+
+int PrevInCol(Occupancy &occ, int x, int y) {
+    return PrevBit(occ.cols + x * occ.colWords, occ.height, y);
+}
+
+bool IsClearRow(Occupancy &occ, int y, int x1, int x2) {
+    if (x1 > x2) swap(x1, x2);
+    return NextInRow(occ, y, x1) > x2;
+}
+
+bool IsClearCol(Occupancy &occ, int x, int y1, int y2) {
+    if (y1 > y2) swap(y1, y2);
+    return NextInCol(occ, x, y1) > y2;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "pos.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Bitboard of the cards still on the board, kept next to the board of each backend so
+// the path engine never has to touch the cards (and their windows) to know if a cell is free.
+// Every row and every column is packed into 64-bit words, a board up to 64 wide
+// takes a single word per row.
+struct Occupancy {
+    int height = 0, width = 0;
+
+    // number of words used by one row / one column
+    int rowWords = 0, colWords = 0;
+
+    // bit x of row y is set when (y, x) holds a card
+    uint64_t *rows = NULL;
+    // bit y of column x is set when (y, x) holds a card
+    uint64_t *cols = NULL;
+};
+
+// start with an empty board, the backends fill it with SetOccupied
+void CreateOccupancy(Occupancy &occ, int height, int width);
+void DeleteOccupancy(Occupancy &occ);
+
+// make dst the same board as src (dst is created on the first copy)
+void CopyOccupancy(Occupancy &dst, Occupancy &src);
+
+bool IsOccupied(Occupancy &occ, Pos pos);
+
+// mark a cell as holding a card or not
+void SetOccupied(Occupancy &occ, Pos pos, bool occupied);
+
+// first card in row y at or after column x, width if there is none
+int NextInRow(Occupancy &occ, int y, int x);
+// last card in row y at or before column x, -1 if there is none
+int PrevInRow(Occupancy &occ, int y, int x);
+
+// first card in column x at or after row y, height if there is none
+int NextInCol(Occupancy &occ, int x, int y);
+// last card in column x at or before row y, -1 if there is none
+int PrevInCol(Occupancy &occ, int x, int y);
+
+// no card in row y between x1 and x2 (both ends included)
+bool IsClearRow(Occupancy &occ, int y, int x1, int x2);
+
+// no card in column x between y1 and y2 (both ends included)
+bool IsClearCol(Occupancy &occ, int x, int y1, int y2);
@@ -0,0 +1,189 @@
+#include "pathfinder.hpp"
+
+#include <climits>
+
+using namespace std;
+
+/*
+Breadth-first search over rays instead of cells: the cells reached with k line
+segments are the free cells lying on rays cast from the cells reached with
+k - 1 segments. The board is padded by one empty cell on each side so paths
+can go around it.
+
+The last turn is closed without casting more rays: a corner on a ray is good
+when it is also on one of the four rays cast from p2. So with the classic
+2 turns, one query casts 4 rays from p1 and 4 rays from every free cell on them.
+*/
+
+// up, down, left, right
+const int DIR_Y[4] = {-1, 1, 0, 0};
+const int DIR_X[4] = {0, 0, -1, 1};
+
+// Scratch space of the search, one per thread so the board is only ever read
+thread_local vector<int> visitStamp; // id of the last search that reached a cell
+thread_local vector<Pos> parent;     // cell the ray reaching a cell was cast from
+thread_local vector<Pos> queue;
+thread_local int searchId = 0;
+
+bool SamePos(Pos a, Pos b) {
+    return a.y == b.y && a.x == b.x;
+}
+
+// Cast a ray from `from` in direction dir, last is set to the furthest free cell (from if none).
+// Every card blocks the ray, p1 included, return true if the ray stops on p2.
+bool CastRay(Occupancy &occ, Pos from, int dir, Pos p1, Pos p2, Pos &last) {
+    bool horizontal = DIR_Y[dir] == 0;
+    int step = horizontal ? DIR_X[dir] : DIR_Y[dir];
+    int line = horizontal ? from.y : from.x;
+    int start = horizontal ? from.x : from.y;
+    int size = horizontal ? occ.width : occ.height;
+    int lineSize = horizontal ? occ.height : occ.width;
+
+    // coordinate where the ray stops, the padding cell is the last free one
+    int stop = step > 0 ? size + 1 : -2;
+
+    // the padding lines around the board are always empty
+    if (0 <= line && line < lineSize) {
+        int card;
+        if (horizontal) {
+            card = step > 0 ? NextInRow(occ, line, start + 1) : PrevInRow(occ, line, start - 1);
+        } else {
+            card = step > 0 ? NextInCol(occ, line, start + 1) : PrevInCol(occ, line, start - 1);
+        }
+
+        if (card != size && card != -1) stop = card;
+    }
+
+    // p1 and p2 stop the ray even when they are not on the board (yet)
+    bool hit = false;
+    Pos ends[2] = {p1, p2};
+    for (int i = 0; i < 2; i++) {
+        int endLine = horizontal ? ends[i].y : ends[i].x;
+        int endAt = horizontal ? ends[i].x : ends[i].y;
+
+        if (endLine != line || (endAt - start) * step <= 0) continue;
+
+        if ((stop - endAt) * step > 0 || (stop == endAt && i == 1)) {
+            stop = endAt;
+            hit = i == 1;
+        }
+    }
+
+    last = from;
+    if (horizontal) last.x = stop - step;
+    else last.y = stop - step;
+
+    return hit;
+}
+
+// index of a cell in the padded board
+int PaddedIndex(Occupancy &occ, Pos pos) {
+    return (pos.y + 1) * (occ.width + 2) + pos.x + 1;
+}
+
+// the corner where a ray cast from `from` meets one of the rays seen from p2
+bool MeetsTarget(Pos from, Pos last, Pos p2, Pos *seen, Pos &corner) {
+    if (from.y == last.y) {
+        // horizontal ray, it meets the column of p2 between the cells seen up and down
+        corner = {from.y, p2.x};
+        if (corner.y == p2.y || corner.y < seen[0].y || seen[1].y < corner.y) return false;
+        return (p2.x - from.x) * (p2.x - last.x) <= 0 && p2.x != from.x;
+    }
+
+    // vertical ray, it meets the row of p2 between the cells seen left and right
+    corner = {p2.y, from.x};
+    if (corner.x == p2.x || corner.x < seen[2].x || seen[3].x < corner.x) return false;
+    return (p2.y - from.y) * (p2.y - last.y) <= 0 && p2.y != from.y;
+}
+
+// write p1, the corners up to `corner`, then the given ending points
+void BuildPath(Occupancy &occ, Pos corner, int corners, Pos *ending, int endingLen, Pos *path, int &pathLen) {
+    pathLen = corners + endingLen;
+
+    for (int i = 0; i < endingLen; i++) path[corners + i] = ending[i];
+
+    // follow the parents back to p1
+    for (int i = corners - 1; i >= 0; i--) {
+        path[i] = corner;
+        corner = parent[PaddedIndex(occ, corner)];
+    }
+}
+
+bool FindPath(Pos p1, Pos p2, Occupancy &occ, Pos *path, int &pathLen, int maxTurns) {
+    if (SamePos(p1, p2)) return false;
+
+    int cells = (occ.height + 2) * (occ.width + 2);
+    if (int(visitStamp.size()) < cells) {
+        visitStamp.assign(cells, 0);
+        parent.resize(cells);
+        queue.resize(cells);
+    }
+
+    // stamps save clearing the scratch space on every search
+    if (++searchId == INT_MAX) {
+        fill(visitStamp.begin(), visitStamp.end(), 0);
+        searchId = 1;
+    }
+
+    // free cells seen from p2: up, down, left, right
+    Pos seen[4];
+    for (int dir = 0; dir < 4; dir++) CastRay(occ, p2, dir, p1, p2, seen[dir]);
+
+    int head = 0, tail = 0;
+    queue[tail++] = p1;
+    visitStamp[PaddedIndex(occ, p1)] = searchId;
+
+    // rays of the segment-th line of the path are cast from the cells reached with one line less
+    for (int segment = 1; segment <= maxTurns + 1 && head < tail; segment++) {
+        int levelEnd = tail;
+        bool found = false;
+        Pos foundFrom, foundCorner;
+
+        for (; head < levelEnd; head++) {
+            Pos from = queue[head];
+
+            for (int dir = 0; dir < 4; dir++) {
+                Pos last;
+
+                if (CastRay(occ, from, dir, p1, p2, last)) {
+                    BuildPath(occ, from, segment, &p2, 1, path, pathLen);
+                    return true;
+                }
+
+                if (SamePos(from, last) || segment > maxTurns) continue;
+
+                // one more line from the ray to p2, keep looking for a path with fewer turns first
+                Pos corner;
+                if (!found && MeetsTarget(from, last, p2, seen, corner)) {
+                    found = true;
+                    foundFrom = from;
+                    foundCorner = corner;
+                }
+
+                if (segment == maxTurns) continue;
+
+                // the cells on the ray are reached with segment lines
+                Pos cell = from;
+                while (!SamePos(cell, last)) {
+                    cell.y += DIR_Y[dir];
+                    cell.x += DIR_X[dir];
+
+                    int index = PaddedIndex(occ, cell);
+                    if (visitStamp[index] == searchId) continue;
+
+                    visitStamp[index] = searchId;
+                    parent[index] = from;
+                    queue[tail++] = cell;
+                }
+            }
+        }
+
+        if (found) {
+            Pos ending[2] = {foundCorner, p2};
+            BuildPath(occ, foundFrom, segment, ending, 2, path, pathLen);
+            return true;
+        }
+    }
+
+    return false;
+}
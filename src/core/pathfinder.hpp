@@ -0,0 +1,16 @@
+#pragma once
+
+#include "pos.hpp"
+#include "occupancy.hpp"
+
+#include <vector>
+
+// Classic rule: a path can turn at most 2 times (I, L, Z and U shapes).
+// Raise it to play with longer paths, every path buffer is sized from it
+// (the MoveSet is then built again after each turn, see UpdateMoveSet).
+#define MAX_TURNS 2
+
+// Find a path with at most maxTurns turns between p1 and p2 going through empty cells only.
+// The path may go around the board one cell outside of it (row -1/height, column -1/width).
+// On success path holds p1, the corners and p2 (maxTurns + 2 points at most).
+bool FindPath(Pos p1, Pos p2, Occupancy &occ, Pos *path, int &pathLen, int maxTurns = MAX_TURNS);
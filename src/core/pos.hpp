@@ -0,0 +1,6 @@
+#pragma once
+
+// Trục y là hàng, trục x là cột
+struct Pos {
+    int y, x;
+};
@@ -0,0 +1,30 @@
+#include "random.hpp"
+
+#include <random>
+
+using namespace std;
+
+// 2^64 / golden ratio, the step of the counter
+#define GOLDEN_GAMMA 0x9E3779B97F4A7C15ULL
+
+uint64_t Mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t SplitMix64(uint64_t &state) {
+    state += GOLDEN_GAMMA;
+    return Mix64(state);
+}
+
+uint64_t BoardSeed(uint64_t seed, uint64_t board) {
+    // jump the counter straight to the board
+    uint64_t state = seed + board * GOLDEN_GAMMA;
+    return SplitMix64(state);
+}
+
+uint64_t RandomSeed() {
+    random_device dev;
+    return (uint64_t(dev()) << 32) | dev();
+}
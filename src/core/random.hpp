@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+// Counter-based random numbers (splitmix64): number n of a stream only depends on the seed
+// and n, so any board of a seeded stream can be made without making the ones before it.
+
+// scramble the bits of z, every input gives a different output
+uint64_t Mix64(uint64_t z);
+
+// next number of the stream, state is the counter
+uint64_t SplitMix64(uint64_t &state);
+
+// seed of board n of the stream started from seed
+uint64_t BoardSeed(uint64_t seed, uint64_t board);
+
+// seed for a new stream when none is given
+uint64_t RandomSeed();
@@ -0,0 +1,224 @@
+#include "solver.hpp"
+
+using namespace std;
+
+// Board after each move of the search, depth d is the board once d pairs are gone.
+// Every depth keeps its own copy so going back up costs nothing.
+struct SolverState {
+    char *symbols = NULL;
+    Occupancy occ;
+    SymbolIndex index;
+    MoveSet moves;
+
+    // Zobrist hash of the cards on the board
+    uint64_t hash = 0;
+};
+
+struct Solver {
+    int height, width;
+    bool slide;
+
+    SolverState *states;
+    int totalPairs;
+
+    // hashes of the boards known to be dead ends
+    uint64_t *table;
+    uint64_t tableMask;
+
+    long long nodes, maxNodes;
+    Move *solution;
+};
+
+// Zobrist key of a card: the keys are mixed from the cell and the symbol
+// instead of being drawn into a table, so the boards of any size share them
+uint64_t CardKey(int cell, char symbol) {
+    return Mix64((uint64_t(cell) * NUM_SYMBOLS + (unsigned char)symbol + 1) * 0x9E3779B97F4A7C15ULL);
+}
+
+// table entries are never 0 so an empty slot never matches
+bool IsDeadEnd(Solver &solver, uint64_t hash) {
+    return solver.table[hash & solver.tableMask] == (hash | 1);
+}
+
+void AddDeadEnd(Solver &solver, uint64_t hash) {
+    solver.table[hash & solver.tableMask] = hash | 1;
+}
+
+void RemoveCard(SolverState &state, int width, Pos pos) {
+    int cell = pos.y * width + pos.x;
+
+    state.hash ^= CardKey(cell, state.symbols[cell]);
+    state.symbols[cell] = EMPTY_SYMBOL;
+
+    SetOccupied(state.occ, pos, false);
+    RemoveFromIndex(state.index, pos);
+}
+
+// same as SlideBoard: the cards right after the removed one move one cell to the left
+void SlideCards(SolverState &state, int width, Pos removedPos) {
+    int y = removedPos.y;
+    int x = removedPos.x + 1;
+
+    if (x == width || state.symbols[y * width + x] == EMPTY_SYMBOL) return;
+
+    while (x < width && state.symbols[y * width + x] != EMPTY_SYMBOL) {
+        char symbol = state.symbols[y * width + x];
+
+        state.hash ^= CardKey(y * width + x, symbol) ^ CardKey(y * width + x - 1, symbol);
+        state.symbols[y * width + x - 1] = symbol;
+        MoveInIndex(state.index, {y, x}, {y, x - 1});
+
+        ++x;
+    }
+
+    state.symbols[y * width + x - 1] = EMPTY_SYMBOL;
+
+    SetOccupied(state.occ, removedPos, true);
+    SetOccupied(state.occ, {y, x - 1}, false);
+}
+
+// copy the board of depth d into depth d + 1 and play move on it
+void PlayMove(Solver &solver, int d, Move move) {
+    SolverState &from = solver.states[d];
+    SolverState &to = solver.states[d + 1];
+    int totalCells = solver.height * solver.width;
+
+    if (to.symbols == NULL) to.symbols = new char[totalCells];
+    for (int i = 0; i < totalCells; i++) to.symbols[i] = from.symbols[i];
+
+    CopyOccupancy(to.occ, from.occ);
+    CopySymbolIndex(to.index, from.index);
+    CopyMoveSet(to.moves, from.moves);
+    to.hash = from.hash;
+
+    Pos removed[2] = {move.p1, move.p2};
+    RemoveCard(to, solver.width, removed[0]);
+    RemoveCard(to, solver.width, removed[1]);
+
+    if (solver.slide) {
+        // right card first, like SlideBoard
+        Pos posL = removed[0], posR = removed[1];
+        if (posL.x > posR.x) swap(posL, posR);
+
+        SlideCards(to, solver.width, posR);
+        SlideCards(to, solver.width, posL);
+    }
+
+    UpdateMoveSet(to.moves, to.occ, to.index, removed, 2, solver.slide);
+}
+
+// Try the moves of the rarest symbols first: they leave the most choices for the others.
+// Without sliding, removing the last pair of a symbol never hurts (cards only leave the board,
+// so every later move stays possible), such a move is played without trying anything else.
+int OrderMoves(Solver &solver, SolverState &state, Move *order) {
+    int count = 0;
+
+    for (int i = 0; i < state.moves.count; i++) {
+        Move move = state.moves.moves[i];
+        unsigned char s = state.symbols[move.p1.y * solver.width + move.p1.x];
+
+        if (!solver.slide && state.index.count[s] == 2) {
+            order[0] = move;
+            return 1;
+        }
+
+        // insertion sort on the number of cards left with the symbol
+        int j = count++;
+        while (j > 0) {
+            Move prev = order[j - 1];
+            unsigned char prevSymbol = state.symbols[prev.p1.y * solver.width + prev.p1.x];
+            if (state.index.count[prevSymbol] <= state.index.count[s]) break;
+
+            order[j] = prev;
+            --j;
+        }
+        order[j] = move;
+    }
+
+    return count;
+}
+
+int Search(Solver &solver, int d) {
+    if (d == solver.totalPairs) return SOLVE_CLEARED;
+
+    SolverState &state = solver.states[d];
+
+    if (IsDeadEnd(solver, state.hash)) return SOLVE_STUCK;
+    if (++solver.nodes > solver.maxNodes) return SOLVE_GAVE_UP;
+
+    Move *order = new Move[state.moves.count];
+    int count = OrderMoves(solver, state, order);
+
+    int result = SOLVE_STUCK;
+    for (int i = 0; i < count && result == SOLVE_STUCK; i++) {
+        solver.solution[d] = order[i];
+
+        PlayMove(solver, d, order[i]);
+        result = Search(solver, d + 1);
+    }
+
+    delete [] order;
+
+    if (result == SOLVE_STUCK) AddDeadEnd(solver, state.hash);
+    return result;
+}
+
+int SolveBoard(char *symbols, int height, int width, bool slide, Move *solution, int &solutionLen,
+               long long maxNodes) {
+    int totalCells = height * width;
+
+    Solver solver;
+    solver.height = height;
+    solver.width = width;
+    solver.slide = slide;
+    solver.nodes = 0;
+    solver.maxNodes = maxNodes;
+    solver.solution = solution;
+
+    solver.totalPairs = 0;
+    for (int i = 0; i < totalCells; i++) {
+        if (symbols[i] != EMPTY_SYMBOL) ++solver.totalPairs;
+    }
+    // a card would be left alone
+    if (solver.totalPairs % 2 != 0) {
+        solutionLen = 0;
+        return SOLVE_STUCK;
+    }
+    solver.totalPairs /= 2;
+
+    solver.table = new uint64_t[1 << SOLVER_TABLE_BITS]();
+    solver.tableMask = (1 << SOLVER_TABLE_BITS) - 1;
+
+    // the deeper boards are only allocated once the search gets there
+    solver.states = new SolverState[solver.totalPairs + 1];
+
+    SolverState &start = solver.states[0];
+    start.symbols = new char[totalCells];
+    CreateOccupancy(start.occ, height, width);
+
+    for (int i = 0; i < totalCells; i++) {
+        start.symbols[i] = symbols[i];
+        if (symbols[i] == EMPTY_SYMBOL) continue;
+
+        SetOccupied(start.occ, {i / width, i % width}, true);
+        start.hash ^= CardKey(i, symbols[i]);
+    }
+
+    CreateSymbolIndex(start.index, symbols, height, width);
+    BuildMoveSet(start.moves, start.occ, start.index);
+
+    int result = Search(solver, 0);
+    solutionLen = result == SOLVE_CLEARED ? solver.totalPairs : 0;
+
+    for (int d = 0; d <= solver.totalPairs; d++) {
+        delete [] solver.states[d].symbols;
+        DeleteOccupancy(solver.states[d].occ);
+        DeleteSymbolIndex(solver.states[d].index);
+        DeleteMoveSet(solver.states[d].moves);
+    }
+
+    delete [] solver.states;
+    delete [] solver.table;
+
+    return result;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "pos.hpp"
+#include "occupancy.hpp"
+#include "symbol-index.hpp"
+#include "pathfinder.hpp"
+#include "move-set.hpp"
+#include "random.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Results of SolveBoard
+#define SOLVE_STUCK 0
+#define SOLVE_CLEARED 1
+// the search ran out of nodes before it could tell
+#define SOLVE_GAVE_UP 2
+
+// states searched before giving up
+#define SOLVER_MAX_NODES 2000000
+
+// the transposition table keeps the last 2^SOLVER_TABLE_BITS dead ends
+#define SOLVER_TABLE_BITS 18
+
+// Can every card of the board be removed?
+// symbols holds height * width symbols row by row, EMPTY_SYMBOL for the empty cells.
+// slide: difficult mode rules, the cards on the right of a removed card slide to the left (SlideBoard).
+// On SOLVE_CLEARED solution holds the pairs to remove in order (room for one move per 2 cards).
+int SolveBoard(char *symbols, int height, int width, bool slide, Move *solution, int &solutionLen,
+               long long maxNodes = SOLVER_MAX_NODES);
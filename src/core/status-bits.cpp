@@ -0,0 +1,34 @@
+#include "status-bits.hpp"
+
+using namespace std;
+
+#define CARDS_PER_BYTE (8 / STATUS_BITS)
+#define STATUS_MASK ((1 << STATUS_BITS) - 1)
+
+void CreateStatusBits(StatusBits &status, int height, int width) {
+    status.height = height;
+    status.width = width;
+    status.bits = new uint8_t[(height * width + CARDS_PER_BYTE - 1) / CARDS_PER_BYTE]();
+}
+
+void DeleteStatusBits(StatusBits &status) {
+    delete [] status.bits;
+
+    status.bits = NULL;
+    status.height = status.width = 0;
+}
+
+int GetStatus(StatusBits &status, Pos pos) {
+    int cell = pos.y * status.width + pos.x;
+    int shift = cell % CARDS_PER_BYTE * STATUS_BITS;
+
+    return (status.bits[cell / CARDS_PER_BYTE] >> shift) & STATUS_MASK;
+}
+
+void SetStatus(StatusBits &status, Pos pos, int value) {
+    int cell = pos.y * status.width + pos.x;
+    int shift = cell % CARDS_PER_BYTE * STATUS_BITS;
+    uint8_t &byte = status.bits[cell / CARDS_PER_BYTE];
+
+    byte = (byte & ~(STATUS_MASK << shift)) | (value << shift);
+}
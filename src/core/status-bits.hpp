@@ -0,0 +1,28 @@
+#pragma once
+
+#include "pos.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Different status of a card
+#define STATUS_NONE 0
+#define STATUS_HIGHLIGHTED 1
+#define STATUS_SELECTED 2
+#define STATUS_REMOVED 3
+
+// bits taken by the status of one card
+#define STATUS_BITS 2
+
+// Status of every card of the board, row by row, 4 cards per byte
+struct StatusBits {
+    int height = 0, width = 0;
+    uint8_t *bits = NULL;
+};
+
+// every card starts with STATUS_NONE
+void CreateStatusBits(StatusBits &status, int height, int width);
+void DeleteStatusBits(StatusBits &status);
+
+int GetStatus(StatusBits &status, Pos pos);
+void SetStatus(StatusBits &status, Pos pos, int value);
@@ -0,0 +1,92 @@
+#include "symbol-index.hpp"
+
+using namespace std;
+
+void CreateSymbolIndex(SymbolIndex &index, char *symbols, int height, int width) {
+    int totalCells = height * width;
+
+    index.height = height;
+    index.width = width;
+    index.cells = new Pos[totalCells];
+    index.slot = new int[totalCells];
+
+    for (int s = 0; s < NUM_SYMBOLS; s++) index.count[s] = 0;
+
+    // size the buckets then lay them out one after another
+    for (int i = 0; i < totalCells; i++) {
+        if (symbols[i] != EMPTY_SYMBOL) ++index.count[(unsigned char)symbols[i]];
+    }
+
+    int offset = 0;
+    for (int s = 0; s < NUM_SYMBOLS; s++) {
+        index.start[s] = offset;
+        offset += index.count[s];
+        index.count[s] = 0;
+    }
+
+    for (int i = 0; i < totalCells; i++) {
+        index.slot[i] = -1;
+        if (symbols[i] == EMPTY_SYMBOL) continue;
+
+        unsigned char s = symbols[i];
+        int at = index.start[s] + index.count[s]++;
+
+        index.cells[at] = {i / width, i % width};
+        index.slot[i] = at;
+    }
+}
+
+void DeleteSymbolIndex(SymbolIndex &index) {
+    delete [] index.cells;
+    delete [] index.slot;
+
+    index.cells = NULL;
+    index.slot = NULL;
+}
+
+void CopySymbolIndex(SymbolIndex &dst, SymbolIndex &src) {
+    int totalCells = src.height * src.width;
+
+    if (dst.cells == NULL) {
+        dst.height = src.height;
+        dst.width = src.width;
+        dst.cells = new Pos[totalCells];
+        dst.slot = new int[totalCells];
+    }
+
+    for (int s = 0; s < NUM_SYMBOLS; s++) {
+        dst.start[s] = src.start[s];
+        dst.count[s] = src.count[s];
+    }
+
+    for (int i = 0; i < totalCells; i++) {
+        dst.cells[i] = src.cells[i];
+        dst.slot[i] = src.slot[i];
+    }
+}
+
+void RemoveFromIndex(SymbolIndex &index, Pos pos) {
+    int at = index.slot[pos.y * index.width + pos.x];
+    if (at == -1) return;
+
+    // find the bucket of the card
+    int s = 0;
+    while (at >= index.start[s] + index.count[s]) ++s;
+
+    // fill the hole with the last card of the bucket
+    int last = index.start[s] + --index.count[s];
+    Pos moved = index.cells[last];
+
+    index.cells[at] = moved;
+    index.slot[moved.y * index.width + moved.x] = at;
+    index.slot[pos.y * index.width + pos.x] = -1;
+}
+
+void MoveInIndex(SymbolIndex &index, Pos from, Pos to) {
+    int at = index.slot[from.y * index.width + from.x];
+    if (at == -1) return;
+
+    index.cells[at] = to;
+    index.slot[to.y * index.width + to.x] = at;
+    index.slot[from.y * index.width + from.x] = -1;
+}
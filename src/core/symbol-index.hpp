@@ -0,0 +1,38 @@
+#pragma once
+
+#include "pos.hpp"
+
+#include <cstddef>
+
+// every value a char can hold
+#define NUM_SYMBOLS 256
+
+// symbol of a cell holding no card
+#define EMPTY_SYMBOL '\0'
+
+// Positions of the cards still on the board grouped by their symbol,
+// so looking for pairs only ever compares cards that can match
+struct SymbolIndex {
+    int height = 0, width = 0;
+
+    // cards of symbol s are cells[start[s]] .. cells[start[s] + count[s] - 1]
+    int start[NUM_SYMBOLS];
+    int count[NUM_SYMBOLS];
+    Pos *cells = NULL;
+
+    // where the card of each board cell is in cells, -1 for an empty cell
+    int *slot = NULL;
+};
+
+// symbols holds height * width symbols row by row, EMPTY_SYMBOL for the empty cells
+void CreateSymbolIndex(SymbolIndex &index, char *symbols, int height, int width);
+void DeleteSymbolIndex(SymbolIndex &index);
+
+// make dst the same index as src (dst is allocated on the first copy)
+void CopySymbolIndex(SymbolIndex &dst, SymbolIndex &src);
+
+// the card at pos left the board
+void RemoveFromIndex(SymbolIndex &index, Pos pos);
+
+// the card at from moved to the empty cell to
+void MoveInIndex(SymbolIndex &index, Pos from, Pos to);
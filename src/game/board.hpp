@@ -0,0 +1,278 @@
+#pragma once
+
+#include "global.hpp"
+#include "engine.hpp"
+#include "view.hpp"
+#include "display.hpp"
+#include "path.hpp"
+#include "frame.hpp"
+#include "extra.hpp"
+
+#include <string>
+#include <algorithm>
+
+#define ST_NORMAL 0
+#define ST_FORCE_OUT 1
+#define ST_SURRENDER 2
+#define ST_FINISHED 3
+#define ST_ASSISTED 4
+#define ST_NOPAIRS 5
+#define ST_RESET 6
+
+// how long a path and the removed pair stay on the board (it used to be a napms)
+#define ANIMATION_MS 150
+
+template <class Board>
+void DisplayCard(Board &board, BoardView &view, Pos pos) {
+    DisplayCard(view, pos, GetSymbol(board, pos));
+}
+
+// the view is drawn with curses over background, DeleteBoardView frees it
+template <class Board>
+void DisplayBoard(Board &board, BoardView &view, int boardHeight, int boardWidth, WINDOW *background) {
+    CreateBoardView(view, boardHeight, boardWidth, LINES, COLS);
+    CreateCursesDisplay(view.display, view, background);
+    view.anims.ms = ANIMATION_MS;
+
+    for (int i = 0; i < boardHeight; i++) {
+        for (int j = 0; j < boardWidth; j++) {
+            if (!IsRemoved(board, {i, j})) DisplayCard(board, view, {i, j});
+        }
+    }
+}
+
+// Updating board according to user inputs
+template <class Board>
+int GetInput(Game<Board> &game, BoardView &view, Pos *selectedPos, Path &path) {
+    int boardHeight = game.height;
+    int boardWidth = game.width;
+    int ch;
+
+    // highlight the first card of the board
+    Pos currPos;
+    
+    bool beenFound = false;
+    for (int i = 0; i < boardHeight; i++) {
+        if (beenFound) break;  
+        for (int j = 0; j < boardWidth; j++) {
+            if (!IsRemoved(game.board, {i, j})) {
+                currPos = {i, j};
+                ToggleCard(game, {i, j});
+                beenFound = true;
+                break;
+            }
+        }
+    }
+    int selectedCards = 0;
+
+    // stop function after getting a pair
+    while (selectedCards < 2) {
+        // push everything changed by the last key to the terminal at once
+        EndFrame("input");
+
+        // the last path keeps fading while waiting
+        ch = GetKey(view);
+        Pos initPos = currPos;
+        int limit;
+        bool toToggle = false;
+
+        switch (ch) {
+            case 'a':
+            case 'A':
+            case KEY_LEFT:
+                if (currPos.x == 0) break;
+
+                // find the end of the offset loop
+                limit = std::max(boardHeight - 1 - currPos.y, currPos.y) * 2 + 1;
+
+                // start from 0 to avoid looping 0 2 times
+                for (int i = 1; i < limit + 1; i++) {
+                    // offset to find card in all rows
+                    int offset = pow(-1, i) * (i / 2);
+                    int tempPos = initPos.y + offset;
+
+                    if (tempPos < 0 || boardHeight <= tempPos) continue;
+
+                    currPos.y = tempPos;
+
+                    // loop until an available card is found in row
+                    while (currPos.x != 0) {
+                        --currPos.x;
+                        if (!IsRemoved(game.board, currPos)) break;
+                    }
+
+                    if (IsRemoved(game.board, currPos) && currPos.x == 0) {
+                        // card not found in row so reset
+                        currPos.x = initPos.x;
+                    } else {
+                        toToggle = true;
+                        break;
+                    }
+                }
+
+                if (!toToggle) {
+                    currPos = initPos;
+                } else MovingSound();
+
+                ToggleCard(game, initPos);
+                ToggleCard(game, currPos);
+
+                break;
+
+            case 'd':
+            case 'D':
+            case KEY_RIGHT:
+                if (currPos.x == boardWidth - 1) break;
+
+                limit = std::max(boardHeight - 1 - currPos.y, currPos.y) * 2 + 1;
+
+                for (int i = 1; i < limit + 1; i++) {
+                    int offset = pow(-1, i) * (i / 2);
+                    int tempPos = initPos.y + offset;
+
+                    if (tempPos < 0 || boardHeight <= tempPos) continue;
+
+                    currPos.y = tempPos;
+
+                    while (currPos.x != boardWidth - 1) {
+                        ++currPos.x;
+                        if (!IsRemoved(game.board, currPos)) break;
+                    }
+
+                    if (IsRemoved(game.board, currPos) && currPos.x == boardWidth - 1) {
+                        currPos.x = initPos.x;
+                    } else {
+                        toToggle = true;
+                        break;
+                    }
+                }
+
+                if (!toToggle) {
+                    currPos = initPos;
+                } else MovingSound();
+
+                ToggleCard(game, initPos);
+                ToggleCard(game, currPos);
+
+                break;
+
+            case 'w':
+            case 'W':
+            case KEY_UP:
+                if (currPos.y == 0) break;
+
+                limit = std::max(boardWidth - 1 - currPos.x, currPos.x) * 2 + 1;
+
+                for (int i = 1; i < limit + 1; i++) {
+                    int offset = pow(-1, i) * (i / 2);
+                    int tempPos = initPos.x + offset;
+
+                    if (tempPos < 0 || boardWidth <= tempPos) continue;
+
+                    currPos.x = tempPos;
+
+                    while (currPos.y != 0) {
+                        --currPos.y;
+                        if (!IsRemoved(game.board, currPos)) break;
+                    }
+
+                    if (IsRemoved(game.board, currPos) && currPos.y == 0) {
+                        currPos.y = initPos.y;
+                    } else {
+                        toToggle = true;
+                        break;
+                    }
+                }
+
+                if (!toToggle) {
+                    currPos = initPos;
+                } else MovingSound();
+
+                ToggleCard(game, initPos);
+                ToggleCard(game, currPos);
+
+                break;
+
+            case 's':
+            case 'S':
+            case KEY_DOWN:
+                if (currPos.y == boardHeight - 1) break;
+
+                limit = std::max(boardWidth - 1 - currPos.x, currPos.x) * 2 + 1;
+
+                for (int i = 1; i < limit + 1; i++) {
+                    int offset = pow(-1, i) * (i / 2);
+                    int tempPos = initPos.x + offset;
+
+                    if (tempPos < 0 || boardWidth <= tempPos) continue;
+
+                    currPos.x = tempPos;
+
+                    while (currPos.y != boardHeight - 1) {
+                        ++currPos.y;
+                        if (!IsRemoved(game.board, currPos)) break;
+                    }
+
+                    if (IsRemoved(game.board, currPos) && currPos.y == boardHeight - 1) {
+                        currPos.y = initPos.y;
+                    } else {
+                        toToggle = true;
+                        break;
+                    }
+                }
+
+                if (!toToggle) {
+                    currPos = initPos;
+                } else MovingSound();
+
+                ToggleCard(game, initPos);
+                ToggleCard(game, currPos);
+
+                break;
+
+            case '\r':
+            case '\n':
+            case KEY_ENTER:
+                if (!SelectCard(game, currPos)) break;
+
+                selectedPos[selectedCards] = currPos;
+                ++selectedCards;
+
+                break;
+
+            case 3: //^C
+                return ST_FORCE_OUT;
+            
+            case '0': // Surrender
+                return ST_SURRENDER;                
+
+            case '9': // Hint
+                // clear selected state of all current cards
+                UnselectCard(game, currPos);
+                for (int i = 0; i < selectedCards; i++) {
+                    UnselectCard(game, selectedPos[i]);
+                }
+
+                // check if there is any valid pair
+                if (GetHint(game, selectedPos, path)) return ST_ASSISTED;
+
+                return ST_NOPAIRS;
+
+            case '8': //endgame check
+                // pretty much the same as the above
+                UnselectCard(game, currPos);
+                for (int i = 0; i < selectedCards; i++) {
+                    UnselectCard(game, selectedPos[i]);
+                }
+
+                if (HasMoves(game)) return ST_RESET;
+
+                return ST_NOPAIRS;
+
+            default:
+                break;
+        }
+    }
+
+    return ST_NORMAL;
+}
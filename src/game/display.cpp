@@ -1,4 +1,6 @@
 #include "display.hpp"
+#include "board.hpp"
+#include "frame.hpp"
 
 using namespace std;
 
@@ -10,8 +12,8 @@ void InteractMenu(Box *menuWins, int options, int hightlight) {
         } else {
             wbkgd(menuWins[i].core, COLOR_PAIR(0));
         }
-        wrefresh(menuWins[i].cover);
-        wrefresh(menuWins[i].core);
+        wnoutrefresh(menuWins[i].cover);
+        wnoutrefresh(menuWins[i].core);
     }
 }
 
@@ -36,12 +38,15 @@ int ChooseMenu(string *menu, int options) {
         menuWins[i].core = derwin(menuWins[i].cover, 1, menuWidth, 1, 1);
         box(menuWins[i].cover, 0, 0);
         mvwaddstr(menuWins[i].core, 0, (menuWidth - menu[i].length()) / 2, menu[i].c_str());
-        wrefresh(menuWins[i].core);
-        wrefresh(menuWins[i].cover);
+        wnoutrefresh(menuWins[i].core);
+        wnoutrefresh(menuWins[i].cover);
     }
     InteractMenu(menuWins, options, highlight);
     
     while(true) {
+        // the whole menu goes to the terminal in one go
+        EndFrame("menu");
+
         ch = getch();
         switch(ch) {
             case 'w':
@@ -86,15 +91,16 @@ void PrintPrompt(WINDOW *&win, string prompt, int lines, int y, int x) {
     wrefresh(win);
 }
 
+// werase, not wclear: wclear makes the next refresh repaint the whole terminal
 void EmptyWin(WINDOW *win) {
     wbkgd(win, COLOR_PAIR(0));
-    wclear(win);
-    wrefresh(win);
+    werase(win);
+    wnoutrefresh(win);
 }
 
 void RemoveWin(WINDOW *win) {
     wbkgd(win, COLOR_PAIR(0));
-    wclear(win);
+    werase(win);
     wrefresh(win);
     delwin(win);
 }
@@ -131,155 +137,6 @@ void DisplayArt(WINDOW *&win, string art) {
     wrefresh(win);
 }
 
-int PlayGame(int height, int width, int mode, int &timeFinished) {
-    // Generate board
-    Card **board;
-    GenerateBoard(board, height, width);
-
-    // Display background
-    WINDOW *background;
-    DisplayArt(background, BACKGROUND);
-    DisplayBoard(board, height, width);
-
-    // Prompt before start
-    WINDOW *promptWin;
-    PrintPrompt(promptWin, "Press any key to continue", 1, LINES - 2);
-
-    getch();
-
-    RemoveWin(promptWin);
-
-    // Play
-    // Start counting time
-    Time startTime = GetCurrTime();
-
-    int pairsRemoved = 0;
-    int totalPairs = height * width / 2;
-    
-    // end the game after removing all of pairs
-    while (pairsRemoved < totalPairs) {
-        // refresh everything
-        clear();
-        refresh();
-        touchwin(background);
-        wrefresh(background);
-        RefreshBoard(board, height, width);
-
-        // Display instruction at the top
-        WINDOW *instructWin;
-        PrintPrompt(instructWin, "8: endgame check  9: Help  0: Surrender", 1, 1);
-
-        Pos *selectedPos = new Pos[2];
-        Pos *path;
-        int pathLen;
-
-        // Getting user input
-        int gameState = GetInput(board, height, width, selectedPos, path, pathLen);
-        
-        // returning different results based on user inputs
-        
-        // Hint
-        if (gameState == ST_ASSISTED) {
-            ToggleCard(board[selectedPos[0].y][selectedPos[0].x]);
-            ToggleCard(board[selectedPos[1].y][selectedPos[1].x]);
-
-            // wait for user to recognize the pair displayed
-            while (true) {
-                char ch = getch();
-                if (ch == '\r' || ch == '\n' || ch == KEY_ENTER) break;
-            }
-
-            CorrectSound();
-
-            DrawPath(board, height, width, path, pathLen);
-            refresh();
-
-            // delay 150 ms
-            napms(150);
-
-            // remove any character pressed when the delay happens
-            flushinp();
-
-            RemovePair(board, selectedPos);
-
-            // slide the board if in diff mode
-            if (mode == MODE_DIFFICULT) SlideBoard(board, width, selectedPos);
-
-            ++pairsRemoved;
-            continue;
-        }
-
-        // Reset after endgame check valid
-        if (gameState == ST_RESET) {
-            WINDOW *prompt;
-            PrintPrompt(prompt, "Valid pair(s) existed. Press any key to continue", 1, LINES - 2);
-            getch();
-            RemoveWin(prompt);
-            continue;
-        }
-
-        // no pair left
-        if (gameState == ST_NOPAIRS) {
-            ErrorSound();
-
-            WINDOW *prompt;
-            PrintPrompt(prompt, "No valid pair left. Press any key to end the game", 1, LINES - 2);
-            
-            getch();
-            clear();
-            RemoveWin(background);
-            RemoveWin(prompt);
-            refresh();
-
-            return ST_SURRENDER;
-        }
-
-        // any other state except normal will be returned like this
-        if (gameState != ST_NORMAL) {
-            clear();
-            RemoveWin(background);
-            refresh();
-            return gameState;
-        }
-
-        if (CheckPaths(selectedPos[0], selectedPos[1], board, height, width, path, pathLen)) {
-            // Valid pair
-            CorrectSound();
-
-            // Display path
-            DrawPath(board, height, width, path, pathLen);
-            refresh();
-
-            // delay 150 ms
-            napms(150);
-
-            // remove any character pressed when the delay happens
-            flushinp();
-
-            RemovePair(board, selectedPos);
-
-            // Slide board if in diff mode
-            if (mode == MODE_DIFFICULT) SlideBoard(board, width, selectedPos);
-
-            ++pairsRemoved;
-        } else {
-            // Invalid pair
-            ErrorSound();
-
-            TogglePair(board, selectedPos);
-        }
-    }
-
-    clear();
-    RemoveWin(background);
-    refresh();
-
-    // Calc playing time
-    timeFinished = ElapsedTime(GetCurrTime(), startTime);
-    
-    return ST_FINISHED;
-}
-
 void DisplayEndScreen(int mode, int height, int width, int time) {
     WINDOW *prompt;
 
@@ -337,6 +194,8 @@ void DisplayEndScreen(int mode, int height, int width, int time) {
     strncpy(data.name, buffer, 10 - 1);
     data.name[9] = '\0';
 
+    data.time = time;
+
     // Update info to the leaderboard
     UpdateLeaderboard(data, height, width);
 }
@@ -360,20 +219,20 @@ void DisplayLeaderboard(int height, int width) {
         win[i] = newwin(NUM_LEADERBOARD * 2 + 1, space[i], startY, startX);
         mvwaddstr(win[i], 0, 0, header[i].c_str());
 
-        wrefresh(win[i]);
+        wnoutrefresh(win[i]);
 
         startX += space[i] + spacing;
     }
 
     for (int i = 0; i < NUM_LEADERBOARD && i < size; i++) {
         PrintInMiddle(win[0], to_string(i + 1).c_str(), i * 2 + 2);
-        wrefresh(win[0]);
+        wnoutrefresh(win[0]);
 
         mvwaddstr(win[1], i * 2 + 2, 0, leaderboard[i].name);
-        wrefresh(win[1]);
+        wnoutrefresh(win[1]);
 
         PrintInMiddle(win[2], to_string(leaderboard[i].time) + "s", i * 2 + 2);
-        wrefresh(win[2]);
+        wnoutrefresh(win[2]);
     }
 
     WINDOW *promptWin;
@@ -1,8 +1,6 @@
 #pragma once
 
 #include "global.hpp"
-#include "board.hpp"
-#include "path.hpp"
 #include "curses.h"
 #include "extra.hpp"
 
@@ -18,6 +16,8 @@ int ChooseMenu(std::string *menu, int options);
 void PrintInMiddle(WINDOW *win, std::string str, int y);
 void PrintPrompt(WINDOW *&win, std::string prompt, int lines = 1, int y = LINES / 2, int x = -1);
 
+// Cards, menus and EmptyWin only mark their windows (wnoutrefresh),
+// the screen is updated once per frame by doupdate or the next wrefresh
 void EmptyWin(WINDOW *win);
 void RemoveWin(WINDOW *win);
 
@@ -27,10 +27,9 @@ void RemoveWin(WINDOW *win);
 
 void DisplayArt(WINDOW *&win, std::string art);
 
-#define MODE_NORMAL 0 //standard mode
-#define MODE_DIFFICULT 1
-
-int PlayGame(int height, int width, int mode, int &timeFinished);
+// play board number boardNum of the stream of boards started from seed.
+// Each build defines it with the PlayBoard of its own board (see play.hpp)
+int PlayGame(int height, int width, int mode, int generator, uint64_t seed, uint64_t boardNum, int &timeFinished);
 
 void DisplayEndScreen(int mode, int height, int width, int time = -1);
 
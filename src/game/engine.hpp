@@ -0,0 +1,230 @@
+#pragma once
+
+#include "rules.hpp"
+
+// The game without any display: a board and everything kept up to date while playing.
+// Nothing here touches curses, whoever shows the game (board.hpp) subscribes to its events
+// and draws what changed. With no listener a game runs at the speed of the rules (see src/bench)
+
+// events sent to the listener
+#define EV_STATUS 0  // status of the card at pos changed to status
+#define EV_REMOVED 1 // the cell at pos is empty now, symbol is the card that left it
+#define EV_MOVED 2   // a card slid into pos, symbol is its symbol
+
+struct GameEvent {
+    int type;
+    Pos pos;
+    int status;
+    char symbol;
+};
+
+typedef void (*GameListener)(GameEvent &event, void *data);
+
+template <class Board>
+struct Game {
+    int height = 0, width = 0;
+    int mode = MODE_NORMAL;
+
+    Board board;
+
+    // Cards on the board, used by the path checks
+    Occupancy occ;
+
+    // Cards grouped by symbol, used by the hint search
+    SymbolIndex index;
+
+    // Pairs that can be connected, kept up to date after every turn
+    MoveSet moves;
+
+    int pairsLeft = 0;
+
+    GameListener listener = NULL;
+    void *listenerData = NULL;
+};
+
+// new game on the symbols given (height * width of them, row by row)
+template <class Board>
+void LoadGame(Game<Board> &game, int height, int width, int mode, char *symbols) {
+    game.height = height;
+    game.width = width;
+    game.mode = mode;
+
+    CreateBoard(game.board, height, width);
+    LoadCards(game.board, symbols);
+
+    BuildOccupancy(game.occ, game.board, height, width);
+    BuildSymbolIndex(game.index, game.board, height, width);
+    BuildMoveSet(game.moves, game.occ, game.index);
+
+    // an odd board has an empty cell, only the cards of the index are counted
+    int cards = 0;
+    for (int s = 0; s < NUM_SYMBOLS; s++) cards += game.index.count[s];
+
+    game.pairsLeft = cards / 2;
+}
+
+// new game on a generated board, the same seed always gives the same game.
+// false: the solvable board couldn't be built, the game is on a classic one
+template <class Board>
+bool NewGame(Game<Board> &game, int height, int width, int mode, int generator, uint64_t seed) {
+    char *symbols = new char[height * width];
+    bool built = GenerateSymbols(symbols, height, width, generator, mode, seed);
+
+    LoadGame(game, height, width, mode, symbols);
+
+    delete [] symbols;
+    return built;
+}
+
+template <class Board>
+void DeleteGame(Game<Board> &game) {
+    DeleteMoveSet(game.moves);
+    DeleteSymbolIndex(game.index);
+    DeleteOccupancy(game.occ);
+    DeleteBoard(game.board);
+
+    game.listener = NULL;
+    game.listenerData = NULL;
+}
+
+// one listener per game, NULL to stop listening
+template <class Board>
+void Subscribe(Game<Board> &game, GameListener listener, void *data) {
+    game.listener = listener;
+    game.listenerData = data;
+}
+
+template <class Board>
+void Notify(Game<Board> &game, int type, Pos pos, char symbol) {
+    if (game.listener == NULL) return;
+
+    GameEvent event;
+    event.type = type;
+    event.pos = pos;
+    event.status = GetStatus(game.board.status, pos);
+    event.symbol = symbol;
+
+    game.listener(event, game.listenerData);
+}
+
+// the symbol is the one stored at pos (a removed card keeps it until its row slides)
+template <class Board>
+void Notify(Game<Board> &game, int type, Pos pos) {
+    if (game.listener == NULL) return;
+
+    Notify(game, type, pos, type == EV_STATUS ? EMPTY_SYMBOL : GetSymbol(game.board, pos));
+}
+
+// State
+
+template <class Board>
+bool IsCleared(Game<Board> &game) {
+    return game.pairsLeft == 0;
+}
+
+// is there still a pair that can be removed?
+template <class Board>
+bool HasMoves(Game<Board> &game) {
+    return game.moves.count > 0;
+}
+
+template <class Board>
+int GetCardStatus(Game<Board> &game, Pos pos) {
+    return GetStatus(game.board.status, pos);
+}
+
+// Cards
+
+// toggel between highlighted and normal(none)
+template <class Board>
+bool ToggleCard(Game<Board> &game, Pos pos) {
+    int status = GetStatus(game.board.status, pos);
+
+    // only allow highilighted and none status
+    if (status == STATUS_SELECTED || status == STATUS_REMOVED)
+        return false;
+
+    SetStatus(game.board.status, pos, status == STATUS_HIGHLIGHTED ? STATUS_NONE : STATUS_HIGHLIGHTED);
+    Notify(game, EV_STATUS, pos);
+
+    return true;
+}
+
+template <class Board>
+bool SelectCard(Game<Board> &game, Pos pos) {
+    if (GetStatus(game.board.status, pos) == STATUS_SELECTED) return false;
+
+    SetStatus(game.board.status, pos, STATUS_SELECTED);
+    Notify(game, EV_STATUS, pos);
+
+    return true;
+}
+
+template <class Board>
+void UnselectCard(Game<Board> &game, Pos pos) {
+    SetStatus(game.board.status, pos, STATUS_NONE);
+    Notify(game, EV_STATUS, pos);
+}
+
+template <class Board>
+void UnselectPair(Game<Board> &game, Pos *pair) {
+    for (int i = 0; i < 2; i++) UnselectCard(game, pair[i]);
+}
+
+// Turns
+
+// Can the pair be removed? path gets the way between them
+template <class Board>
+bool CheckPair(Game<Board> &game, Pos *pair, Path &path) {
+    return CheckPaths(pair[0], pair[1], game.board, game.occ, path);
+}
+
+// a pair that can be removed and its path, false if there is none
+template <class Board>
+bool GetHint(Game<Board> &game, Pos *pair, Path &path) {
+    if (game.moves.count == 0) return false;
+
+    pair[0] = game.moves.moves[0].p1;
+    pair[1] = game.moves.moves[0].p2;
+    FindPath(pair[0], pair[1], game.occ, path.point, path.len);
+
+    return true;
+}
+
+// difficult mode, slide the row of removedPos from right to left
+template <class Board>
+void SlideRow(Game<Board> &game, Pos removedPos) {
+    // the removed card ends up at lastX, the cell left empty (the storages move it there too)
+    char removedSymbol = GetSymbol(game.board, removedPos);
+
+    int lastX = SlideCards(game.board, game.occ, game.index, game.width, removedPos);
+    if (lastX == removedPos.x) return;
+
+    for (int x = removedPos.x; x < lastX; x++) Notify(game, EV_MOVED, {removedPos.y, x});
+
+    Notify(game, EV_REMOVED, {removedPos.y, lastX}, removedSymbol);
+}
+
+// Remove a pair (checked before with CheckPair or given by GetHint),
+// slide the board in difficult mode and update the moves left
+template <class Board>
+void RemovePair(Game<Board> &game, Pos *pair) {
+    RemoveCards(game.board, game.occ, game.index, pair);
+
+    for (int i = 0; i < 2; i++) Notify(game, EV_REMOVED, pair[i]);
+
+    if (game.mode == MODE_DIFFICULT) {
+        Pos posL = pair[0];
+        Pos posR = pair[1];
+
+        if (posL.x > posR.x) std::swap(posL, posR);
+
+        // slide card on the right first because SlideCards only works with row having 1 removed card
+        SlideRow(game, posR);
+        SlideRow(game, posL);
+    }
+
+    UpdateMoveSet(game.moves, game.occ, game.index, pair, 2, game.mode == MODE_DIFFICULT);
+
+    --game.pairsLeft;
+}
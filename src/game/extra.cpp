@@ -2,32 +2,42 @@
 
 using namespace std;
 
+void PlayWav(const char *path)
+{
+#ifdef _WIN32
+    PlaySoundA(path, NULL, SND_FILENAME | SND_ASYNC);
+#else
+    // no sound outside of windows
+    (void)path;
+#endif
+}
+
 //Win or lose
 void WinSound()
 {
-    PlaySound(TEXT("resources/Winning.wav"), NULL, SND_FILENAME | SND_ASYNC);
+    PlayWav("resources/Winning.wav");
 }
 
 void LoseSound()
 {
-    PlaySound(TEXT("resources/Losing.wav"), NULL, SND_FILENAME | SND_ASYNC);
+    PlayWav("resources/Losing.wav");
 }
 
 //Correct or incorrect
 void CorrectSound()
 {
-    PlaySound(TEXT("resources/Correct.wav"), NULL, SND_FILENAME | SND_ASYNC);
+    PlayWav("resources/Correct.wav");
 }
 
 void ErrorSound()
 {
-    PlaySound(TEXT("resources/Error.wav"), NULL, SND_FILENAME | SND_ASYNC);
+    PlayWav("resources/Error.wav");
 }
 
 //Moving between cards
 void MovingSound()
 {
-    PlaySound(TEXT("resources/Moving.wav"), NULL, SND_FILENAME | SND_ASYNC);
+    PlayWav("resources/Moving.wav");
 }
 
 
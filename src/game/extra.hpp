@@ -1,7 +1,13 @@
 #pragma once
 
+// sounds only play on windows, elsewhere (ncurses on linux) the game is silent
+#ifdef _WIN32
 #include <windows.h>
 #include <MMsystem.h>
+#endif
+
+#include <cstring>
+#include <cmath>
 #include <string>
 #include <fstream>
 #include <chrono>
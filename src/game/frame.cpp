@@ -0,0 +1,216 @@
+#include "frame.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+using namespace std;
+
+FILE *frameLog = NULL;
+long long frameNum = 0;
+
+// bytes written when the last frame ended, and the ones of the log since
+long long lastWritten = -1;
+long long logBytes = 0;
+
+Rect WinRect(WINDOW *win) {
+    return {getbegy(win), getbegx(win), getmaxy(win), getmaxx(win)};
+}
+
+void OpenFrameLog(const char *path) {
+    frameLog = fopen(path, "w");
+    lastWritten = BytesWritten();
+}
+
+void CloseFrameLog() {
+    if (frameLog) fclose(frameLog);
+    frameLog = NULL;
+}
+
+long long BytesWritten() {
+#ifdef __linux__
+    FILE *io = fopen("/proc/self/io", "r");
+    if (io == NULL) return -1;
+
+    // wchar: every byte passed to write() so far
+    char key[32];
+    long long value;
+    long long written = -1;
+
+    while (fscanf(io, "%31s %lld", key, &value) == 2) {
+        if (strcmp(key, "wchar:") == 0) {
+            written = value;
+            break;
+        }
+    }
+
+    fclose(io);
+    return written;
+#else
+    return -1;
+#endif
+}
+
+void EndFrame(const char *name) {
+    doupdate();
+    ++frameNum;
+
+    if (frameLog == NULL) return;
+
+    long long written = BytesWritten();
+    long long bytes = (written < 0 || lastWritten < 0) ? -1 : written - lastWritten - logBytes;
+
+    // the line of the log is written too, it's taken out of the next frame
+    logBytes = fprintf(frameLog, "frame %lld %s: %lld bytes\n", frameNum, name, bytes);
+    fflush(frameLog);
+
+    lastWritten = written;
+}
+
+// Curses backend
+
+struct CursesDisplay {
+    WINDOW *pad;
+    WINDOW *background;
+    WINDOW *top = NULL;
+
+    // screen pos of the pad
+    int y, x;
+};
+
+chtype CursesChar(int ch) {
+    switch (ch) {
+        case CELL_HLINE: return ACS_HLINE;
+        case CELL_VLINE: return ACS_VLINE;
+        case CELL_ULCORNER: return ACS_ULCORNER;
+        case CELL_URCORNER: return ACS_URCORNER;
+        case CELL_LLCORNER: return ACS_LLCORNER;
+        case CELL_LRCORNER: return ACS_LRCORNER;
+        default: return (unsigned char)ch;
+    }
+}
+
+void CursesPut(void *data, int layer, int y, int x, int ch, int color) {
+    CursesDisplay &curses = *(CursesDisplay *)data;
+
+    mvwaddch(layer == LAYER_BOARD ? curses.pad : stdscr, y, x, CursesChar(ch) | COLOR_PAIR(color));
+}
+
+void CursesRecolor(void *data, int layer, int y, int x, int n, int color) {
+    CursesDisplay &curses = *(CursesDisplay *)data;
+
+    mvwchgat(layer == LAYER_BOARD ? curses.pad : stdscr, y, x, n, A_NORMAL, color, NULL);
+}
+
+void CursesShow(void *data, int layer, Rect rect) {
+    CursesDisplay &curses = *(CursesDisplay *)data;
+
+    // stdscr copies whatever changed on it
+    if (layer == LAYER_OVERLAY) {
+        wnoutrefresh(stdscr);
+        return;
+    }
+
+    // the pad copies only what it knows has changed
+    touchline(curses.pad, rect.y, rect.height);
+    pnoutrefresh(curses.pad, rect.y, rect.x, curses.y + rect.y, curses.x + rect.x,
+                 curses.y + rect.y + rect.height - 1, curses.x + rect.x + rect.width - 1);
+}
+
+// the rows from y to y + height - 1 of the screen, cut to the window
+void TouchRows(WINDOW *win, int y, int height) {
+    int top = max(y, getbegy(win));
+    int bottom = min(y + height, getbegy(win) + getmaxy(win));
+
+    if (top < bottom) touchline(win, top - getbegy(win), bottom - top);
+}
+
+void CursesRestore(void *data, Rect rect) {
+    CursesDisplay &curses = *(CursesDisplay *)data;
+
+    // overlays (the paths) are on stdscr, erase them. Without clear() so the terminal still only gets what differs
+    int left = max(rect.x, 0);
+    int right = min(rect.x + rect.width, COLS);
+    if (left >= right) return;
+
+    for (int y = max(rect.y, 0); y < min(rect.y + rect.height, LINES); y++) {
+        mvwhline(stdscr, y, left, ' ', right - left);
+    }
+
+    // only the parts just touched are copied, the background by whole rows
+    wnoutrefresh(stdscr);
+
+    if (curses.background) {
+        TouchRows(curses.background, rect.y, rect.height);
+        wnoutrefresh(curses.background);
+    }
+
+    if (curses.top) {
+        TouchRows(curses.top, rect.y, rect.height);
+        wnoutrefresh(curses.top);
+    }
+}
+
+void CursesEndFrame(void *, const char *name) {
+    EndFrame(name);
+}
+
+void CursesClose(void *data) {
+    CursesDisplay *curses = (CursesDisplay *)data;
+
+    if (curses->pad) delwin(curses->pad);
+    delete curses;
+}
+
+void CreateCursesDisplay(Display &display, BoardView &view, WINDOW *background) {
+    CursesDisplay *curses = new CursesDisplay;
+
+    // a pad can be bigger than the screen, only the rects of the cards are ever shown
+    curses->pad = newpad(view.rows, view.cols);
+    curses->background = background;
+    curses->y = view.y;
+    curses->x = view.x;
+
+    display.data = curses;
+    display.put = CursesPut;
+    display.recolor = CursesRecolor;
+    display.show = CursesShow;
+    display.restore = CursesRestore;
+    display.endFrame = CursesEndFrame;
+    display.close = CursesClose;
+}
+
+void SetCursesTop(Display &display, WINDOW *top) {
+    ((CursesDisplay *)display.data)->top = top;
+}
+
+// Animations
+
+// done the ones due and push them to the terminal
+void RunFrame(BoardView &view) {
+    if (!RunAnimations(view, AnimationClock())) return;
+
+    DrawFrame(view);
+    EndFrame("animation");
+}
+
+int GetKey(BoardView &view) {
+    while (true) {
+        RunFrame(view);
+
+        // wait for a key until the next animation is due, forever if there is none
+        timeout(NextAnimation(view, AnimationClock()));
+        int ch = getch();
+
+        if (ch == ERR) continue;
+
+        timeout(-1);
+        return ch;
+    }
+}
+
+void WaitAnimations(BoardView &view) {
+    while (view.anims.count > 0) {
+        napms(NextAnimation(view, AnimationClock()));
+        RunFrame(view);
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "global.hpp"
+#include "curses.h"
+
+#include <cstdio>
+
+// Frames of the screen. Between two frames the display only marks what changed,
+// EndFrame pushes it all to the terminal with one doupdate.
+// Whatever is drawn over the board and has to go away later (paths, prompts, emptied cards)
+// marks its rect dirty, the next frame paints only those rects again (DrawFrame in view.hpp)
+
+// screen rect of a window
+Rect WinRect(WINDOW *win);
+
+// Frame stats: with a log (-f option of the game) every frame writes the bytes it sent to the terminal.
+// They are counted from the bytes written by the program (linux only, -1 elsewhere)
+void OpenFrameLog(const char *path);
+void CloseFrameLog();
+
+long long BytesWritten();
+
+// push everything marked to the terminal, name: what the frame was for (shown in the log)
+void EndFrame(const char *name);
+
+// Curses backend of a BoardView: the cards in one pad, the overlay on stdscr
+// and background (can be NULL) under both. Works with PDCurses and ncurses
+void CreateCursesDisplay(Display &display, BoardView &view, WINDOW *background);
+// a window kept above the board (the instructions), shown again wherever the screen under it is painted again
+void SetCursesTop(Display &display, WINDOW *top);
+
+// getch, the animations of the view go on while waiting for the key (a frame each time some are done)
+int GetKey(BoardView &view);
+// wait until every animation of the view is done, the keys pressed meanwhile stay
+void WaitAnimations(BoardView &view);
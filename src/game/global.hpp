@@ -0,0 +1,9 @@
+#pragma once
+
+#include "curses.h"
+#include "view.hpp"
+
+struct Box {
+    WINDOW *cover = NULL;
+    WINDOW *core = NULL;
+};
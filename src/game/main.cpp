@@ -2,6 +2,10 @@
 #include "board.hpp"
 #include "display.hpp"
 #include "path.hpp"
+#include "frame.hpp"
+
+#include <cstdlib>
+#include <cstring>
 
 #define MAIN_MENU_NUM 3
 std::string mainMenu[MAIN_MENU_NUM] = {"PLAY", "LEADERBOARD" , "EXIT"};
@@ -12,9 +16,25 @@ std::string playMenu[PLAY_MENU_NUM] = {"STANDARD MODE", "DIFFICULT MODE", "BACK"
 #define SIZE_MENU_NUM 4
 std::string sizeMenu[SIZE_MENU_NUM] = {"2 X 3", "4 X 6", "6 X 8", "BACK"};
 
+#define BOARD_MENU_NUM 3
+std::string boardMenu[BOARD_MENU_NUM] = {"SOLVABLE BOARD", "RANDOM BOARD", "BACK"};
+
 using namespace std;
 
-int main() {
+// Usage: <game> [-s seed] [-n board] [-f file]
+// every game plays the next board of the stream of boards started from seed (random if not given),
+// -n starts the stream at board n, so a board can be played again with the same seed and number.
+// -f writes the bytes sent to the terminal by every frame into file
+int main(int argc, char **argv) {
+    uint64_t seed = RandomSeed();
+    uint64_t boardNum = 0;
+
+    // a flag without its value at the end is ignored
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) seed = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) boardNum = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) OpenFrameLog(argv[++i]);
+    }
 
     // Setup terminal
     initscr();
@@ -84,8 +104,29 @@ int main() {
                     // if back is pressed than back to the main menu
                     if (back) break;
 
+                    int generator = GEN_CLASSIC;
+
+                    switch(ChooseMenu(boardMenu, BOARD_MENU_NUM)) {
+                        case 0: // always has a solution
+                            generator = GEN_SOLVABLE;
+                            break;
+
+                        case 1: // may get stuck
+                            generator = GEN_CLASSIC;
+                            break;
+
+                        case 2: // back
+                            back = true;
+                            break;
+
+                        default:
+                            break;
+                    }
+
+                    if (back) break;
+
                     int timeFinished;
-                    switch(PlayGame(height, width, mode, timeFinished)) {
+                    switch(PlayGame(height, width, mode, generator, seed, boardNum++, timeFinished)) {
                         case ST_FORCE_OUT: // Pressing Ctrl + C
                             isRunning = false;
                             break;
@@ -148,5 +189,7 @@ int main() {
 
     endwin(); // delelete and end all curses windows
 
+    CloseFrameLog();
+
     return 0;
 }
\ No newline at end of file
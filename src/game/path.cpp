@@ -0,0 +1,148 @@
+#include "path.hpp"
+
+using namespace std;
+
+// paths are drawn in cyan (color pair 2) above everything
+void PutPath(Display &display, int y, int x, int ch) {
+    display.put(display.data, LAYER_OVERLAY, y, x, ch, 2);
+}
+
+// Draw the corner based on the last line and current line direction
+void DrawCorner(Display &display, Pos &point, int lastDr, int currDr) {
+    if ((lastDr == DR_UP && currDr == DR_RIGHT) || (lastDr == DR_LEFT && currDr == DR_DOWN)) {
+        PutPath(display, point.y, point.x, CELL_ULCORNER);
+        PutPath(display, point.y, point.x + 1, CELL_HLINE);
+        PutPath(display, point.y + 1, point.x, CELL_VLINE);
+        return ;
+    }
+    if ((lastDr == DR_RIGHT && currDr == DR_DOWN) || (lastDr == DR_UP && currDr == DR_LEFT)) {
+        PutPath(display, point.y, point.x, CELL_URCORNER);
+        PutPath(display, point.y, point.x - 1, CELL_HLINE);
+        PutPath(display, point.y + 1, point.x, CELL_VLINE);
+        return ;
+    }
+    if ((lastDr == DR_DOWN && currDr == DR_LEFT) || (lastDr == DR_RIGHT && currDr == DR_UP)) {
+        PutPath(display, point.y, point.x, CELL_LRCORNER);
+        PutPath(display, point.y, point.x - 1, CELL_HLINE);
+        PutPath(display, point.y - 1, point.x, CELL_VLINE);  
+        return ;
+    }
+    // left + up & down + right;
+    PutPath(display, point.y, point.x, CELL_LLCORNER);
+    PutPath(display, point.y, point.x + 1, CELL_HLINE);
+    PutPath(display, point.y - 1, point.x, CELL_VLINE);
+}
+
+// Draw line between 2 points
+void DrawLine(Display &display, Pos point1, Pos point2, int &direction) {
+    // Finding the direction of the line and then draw
+    int startPos;
+
+    if (point1.x == point2.x) {
+        if (point1.y < point2.y) {
+            startPos = point1.y + CARD_HEIGHT / 2;
+            direction = DR_DOWN;
+        } else {
+            startPos = point2.y + CARD_HEIGHT / 2;
+            direction = DR_UP;
+        }
+
+        int len = abs(point2.y - point1.y) + 1 - (CARD_HEIGHT / 2) * 2;
+        for (int i = 0; i < len; i++) PutPath(display, startPos + i, point1.x, CELL_VLINE);
+
+        return ;
+    }
+    
+    // equal y
+    if (point1.x < point2.x) {
+        startPos = point1.x + CARD_WIDTH / 2;
+        direction = DR_RIGHT;
+    } else {
+        startPos = point2.x + CARD_WIDTH / 2;
+        direction = DR_LEFT;
+    }
+
+    int len = abs(point2.x - point1.x) + 1 - (CARD_WIDTH / 2) * 2;
+    for (int i = 0; i < len; i++) PutPath(display, point1.y, startPos + i, CELL_HLINE);
+}
+
+int DrawPath(BoardView &view, int boardHeight, int boardWidth, Path &path, Rect *lines) {
+    int lineCount = 0;
+
+    Pos lastPoint, currPoint;
+    int lastDr, currDr;
+    int offsetSadCase = 0;
+
+    // lopp through the path
+    for (int i = 0; i < path.len; i++) {
+        // Calculate the screen pos that a point on the path
+        int y = path.point[i].y;
+        int x = path.point[i].x;
+        
+        if (i != 0) lastPoint = currPoint;
+
+        // Calulate offset to the card's window posistion
+        if (path.point[i].y == -1) {
+            currPoint.y = - 1 - CARD_SPACE / 2 - CARD_HEIGHT / 2;
+            ++y;
+        } else if (path.point[i].y == boardHeight) {
+            currPoint.y = CARD_HEIGHT + CARD_HEIGHT / 2;
+            --y;
+        } else {
+            currPoint.y = CARD_HEIGHT / 2;
+        }
+
+        if (path.point[i].x == -1) {
+            currPoint.x = - 1 - CARD_SPACE - CARD_WIDTH / 2;
+            ++x;
+        } else if (path.point[i].x == boardWidth) {
+            currPoint.x = CARD_WIDTH + CARD_WIDTH / 2;
+            --x;
+        } else {
+            currPoint.x = CARD_WIDTH / 2;
+        }
+
+        // Adding the card's pos in the layout to get the final screen posistion
+        Rect &rect = view.layout[y * view.width + x];
+        currPoint.y += view.y + rect.y;
+        currPoint.x += view.x + rect.x;
+
+        // we need 2 point to draw, so skip the first time
+        if (i == 0) continue;
+
+        // value return from checkpath by Hoang gives dupliacate values in L case, this is patch to it
+        if (lastPoint.x == currPoint.x && lastPoint.y == currPoint.y) {
+            ++offsetSadCase;
+            continue;
+        }
+
+        lastDr = currDr;
+
+        // Draw line between 2 points
+        DrawLine(view.display, lastPoint, currPoint, currDr);
+
+        // the line and its corners stay inside the rect of the 2 points
+        Rect line = {min(lastPoint.y, currPoint.y), min(lastPoint.x, currPoint.x),
+                     abs(currPoint.y - lastPoint.y) + 1, abs(currPoint.x - lastPoint.x) + 1};
+        lines[lineCount++] = line;
+
+        // Draw the starting corner only after 1 line has been drawn
+        if (i > 1 + offsetSadCase) DrawCorner(view.display, lastPoint, lastDr, currDr);
+
+        // crucial to show every line on its own, without it, random bugs may appear.
+        // It's only marked, the caller pushes the whole path at once.
+        // One more cell around for the corner, its arms go into the last line too
+        view.display.show(view.display.data, LAYER_OVERLAY, {line.y - 1, line.x - 1, line.height + 2, line.width + 2});
+    }
+
+    return lineCount;
+}
+
+void AnimatePath(BoardView &view, int boardHeight, int boardWidth, Path &path) {
+    Animation task;
+    task.type = ANIM_PATH;
+    task.path = path;
+    task.lineCount = DrawPath(view, boardHeight, boardWidth, path, task.lines);
+
+    Animate(view, task);
+}
\ No newline at end of file
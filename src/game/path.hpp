@@ -0,0 +1,18 @@
+#pragma once
+
+#include "view.hpp"
+
+#include <string>
+#include <algorithm>
+
+#define DR_UP 1
+#define DR_DOWN -1
+#define DR_LEFT 2
+#define DR_RIGHT -2
+
+// Draws the path over the board, lines gets the screen rect of every line drawn (MAX_PATH_LINES at most).
+// Returns how many, whoever drew it marks them dirty to erase it
+int DrawPath(BoardView &view, int boardHeight, int boardWidth, Path &path, Rect *lines);
+
+// the path stays for view.anims.ms, then it's erased by the next frame
+void AnimatePath(BoardView &view, int boardHeight, int boardWidth, Path &path);
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "global.hpp"
+#include "board.hpp"
+#include "display.hpp"
+#include "path.hpp"
+#include "extra.hpp"
+
+#include <string>
+
+// The game loop, the same for every way of storing the board.
+// Board is the storage of the cards (ArrayBoard, ListBoard, BitBoard...),
+// everything it has to provide is listed in rules.hpp
+template <class Board>
+int PlayBoard(int height, int width, int mode, int generator, uint64_t seed, uint64_t boardNum, int &timeFinished) {
+    // Generate board, the game itself never touches the screen
+    Game<Board> game;
+    bool built = NewGame(game, height, width, mode, generator, BoardSeed(seed, boardNum));
+
+    // Display background
+    WINDOW *background;
+    DisplayArt(background, BACKGROUND);
+
+    // the cards, all in one pad
+    BoardView view;
+    DisplayBoard(game.board, view, height, width, background);
+
+    // everything changing on the board from now is drawn by the events of the game
+    Subscribe(game, DrawGameEvent, &view);
+
+    // Prompt before start
+    WINDOW *promptWin;
+    // the board asked for couldn't be built, the player is told this one may get stuck
+    if (built) PrintPrompt(promptWin, "Press any key to continue", 1, LINES - 2);
+    else PrintPrompt(promptWin, "No solvable board this time, it may get stuck. Press any key to continue", 1, LINES - 2);
+
+    getch();
+
+    RemoveWin(promptWin);
+
+    // Display instruction at the top, it stays for the whole game
+    WINDOW *instructWin;
+    PrintPrompt(instructWin, "8: endgame check  9: Help  0: Surrender  (seed " + std::to_string(seed) + ", board " + std::to_string(boardNum) + ")", 1, 1);
+
+    // the instruction stays above everything
+    SetCursesTop(view.display, instructWin);
+
+    // Play
+    // Start counting time
+    Time startTime = GetCurrTime();
+
+    // end the game after removing all of pairs
+    while (!IsCleared(game)) {
+        // paint again only what changed since the last frame (everything the first time)
+        DrawFrame(view);
+
+        Pos selectedPos[2];
+        Path path;
+
+        // Getting user input, unless there is no valid pair left
+        int gameState = !HasMoves(game) ? ST_NOPAIRS : GetInput(game, view, selectedPos, path);
+        
+        // returning different results based on user inputs
+        
+        // Hint
+        if (gameState == ST_ASSISTED) {
+            ToggleCard(game, selectedPos[0]);
+            ToggleCard(game, selectedPos[1]);
+            EndFrame("hint");
+
+            // wait for user to recognize the pair displayed
+            while (true) {
+                int ch = GetKey(view);
+                if (ch == '\r' || ch == '\n' || ch == KEY_ENTER) break;
+            }
+
+            CorrectSound();
+
+            // the path fades while the game goes on
+            AnimatePath(view, height, width, path);
+
+            // slides the board too if in diff mode
+            RemovePair(game, selectedPos);
+            continue;
+        }
+
+        // Reset after endgame check valid
+        if (gameState == ST_RESET) {
+            // nothing fades under the prompt
+            FinishAnimations(view);
+            DrawFrame(view);
+
+            WINDOW *prompt;
+            PrintPrompt(prompt, "Valid pair(s) existed. Press any key to continue", 1, LINES - 2);
+            getch();
+            MarkDirty(view.dirty, WinRect(prompt));
+            RemoveWin(prompt);
+            continue;
+        }
+
+        // no pair left
+        if (gameState == ST_NOPAIRS) {
+            ErrorSound();
+
+            WINDOW *prompt;
+            PrintPrompt(prompt, "No valid pair left. Press any key to end the game", 1, LINES - 2);
+            
+            getch();
+            clear();
+            RemoveWin(background);
+            RemoveWin(prompt);
+            refresh();
+
+            delwin(instructWin);
+            DeleteGame(game);
+            DeleteBoardView(view);
+            return ST_SURRENDER;
+        }
+
+        // any other state except normal will be returned like this
+        if (gameState != ST_NORMAL) {
+            clear();
+            RemoveWin(background);
+            refresh();
+            delwin(instructWin);
+            DeleteGame(game);
+            DeleteBoardView(view);
+            return gameState;
+        }
+
+        if (CheckPair(game, selectedPos, path)) {
+            // Valid pair
+            CorrectSound();
+
+            // Display path, it goes away by itself so the next pair can be chosen right away
+            AnimatePath(view, height, width, path);
+
+            // Slides board too if in diff mode
+            RemovePair(game, selectedPos);
+        } else {
+            // Invalid pair
+            ErrorSound();
+
+            UnselectPair(game, selectedPos);
+        }
+    }
+
+    // let the last pair go before leaving the board, the keys pressed for it are thrown away
+    WaitAnimations(view);
+    flushinp();
+
+    clear();
+    RemoveWin(background);
+    refresh();
+
+    delwin(instructWin);
+    DeleteGame(game);
+    DeleteBoardView(view);
+
+    // Calc playing time
+    timeFinished = ElapsedTime(GetCurrTime(), startTime);
+    
+    return ST_FINISHED;
+}
@@ -0,0 +1,189 @@
+#include "rules.hpp"
+
+#include <climits>
+
+using namespace std;
+
+bool GenerateSymbols(char *symbols, int height, int width, int generator, int mode, uint64_t seed) {
+    int totalCards = height * width;
+
+    // Initialize random generator from the 64 bits of the seed
+    seed_seq seq = {uint32_t(seed), uint32_t(seed >> 32)};
+    mt19937 gen(seq);
+
+    // Board with a solution. The classic one is dealt if it can't be built, but false is returned
+    bool built = true;
+    if (generator == GEN_SOLVABLE) {
+        if (GenerateSolvable(symbols, height, width, mode == MODE_DIFFICULT, gen)) return true;
+        built = false;
+    }
+
+    // Put random letters into the board. The letters left in the alphabet are spread over the pairs left,
+    // boards of more than 26 pairs go through it again (offsets are taken modulo the alphabet)
+    int offset = 0;
+    int pairsLeft = totalCards / 2;
+
+    for (int i = 0; i < totalCards - 1; i += 2) {
+        // Randomize offsets from 'A'
+        int lettersLeft = NUM_LETTERS - 1 - offset % NUM_LETTERS;
+        uniform_int_distribution<int> offsetDist(offset, offset + lettersLeft / pairsLeft);
+
+        offset = offsetDist(gen);
+
+        symbols[i] = 'A' + offset % NUM_LETTERS;
+        symbols[i + 1] = 'A' + offset % NUM_LETTERS;
+
+        ++offset; // no offset is included twice
+        --pairsLeft;
+    }
+
+    // odd boards, one cell has no pair
+    if (totalCards % 2 != 0) symbols[totalCards - 1] = EMPTY_SYMBOL;
+
+    // shuffle the board
+    uniform_int_distribution<int> heightDist(0, height - 1);
+    uniform_int_distribution<int> widthDist(0, width - 1);
+
+    for (int i = 0; i < height; i += 1 + NON_RANDOMNESS) {
+        for (int j = 0; j < width; j += 1 + NON_RANDOMNESS) {
+            swap(symbols[i * width + j], symbols[heightDist(gen) * width + widthDist(gen)]);
+        }
+    }
+
+    // the empty cell goes back to the end of the last row, so the rows stay left-packed in difficult mode
+    if (totalCards % 2 != 0) {
+        for (int i = 0; i < totalCards; i++) {
+            if (symbols[i] == EMPTY_SYMBOL) swap(symbols[i], symbols[totalCards - 1]);
+        }
+    }
+
+    return built;
+}
+
+bool FindHint(Occupancy &occ, SymbolIndex &index, Path &path) {
+    // only cards with the same symbol can make a pair
+    for (int s = 0; s < NUM_SYMBOLS; s++) {
+        Pos *cards = index.cells + index.start[s];
+
+        for (int i = 0; i < index.count[s] - 1; i++) {
+            for (int j = i + 1; j < index.count[s]; j++) {
+                if (FindPath(cards[i], cards[j], occ, path.point, path.len)) return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Part of a search done by thread k of the pool: the first cards of the pairs are numbered in index order,
+// thread k of n takes the cards k, k + n, k + 2n...
+void SearchHint(HintPool &pool, int k) {
+    SymbolIndex &index = *pool.index;
+    int number = 0;
+
+    pool.found[k] = INT_MAX;
+
+    for (int s = 0; s < NUM_SYMBOLS; s++) {
+        Pos *cards = index.cells + index.start[s];
+
+        for (int i = 0; i < index.count[s] - 1; i++, number++) {
+            if (number % pool.threads != k) continue;
+
+            // a lower pair is already found, nothing better can come from here
+            int currBest = pool.best.load();
+            if (number > currBest) return;
+
+            for (int j = i + 1; j < index.count[s]; j++) {
+                Path &path = pool.paths[k];
+                if (!FindPath(cards[i], cards[j], *pool.occ, path.point, path.len)) continue;
+
+                pool.found[k] = number;
+                while (number < currBest && !pool.best.compare_exchange_weak(currBest, number)) {}
+                return;
+            }
+        }
+    }
+}
+
+void HintWorker(HintPool &pool, int k) {
+    int round = 0;
+
+    while (true) {
+        {
+            unique_lock<mutex> lock(pool.lock);
+            while (!pool.quit && pool.round == round) pool.wake.wait(lock);
+
+            if (pool.quit) return;
+            round = pool.round;
+        }
+
+        SearchHint(pool, k);
+
+        lock_guard<mutex> lock(pool.lock);
+        if (--pool.running == 0) pool.done.notify_one();
+    }
+}
+
+void CreateHintPool(HintPool &pool, int threads) {
+    if (threads <= 0) threads = thread::hardware_concurrency();
+    if (threads <= 0) threads = 1;
+
+    pool.threads = threads;
+    pool.paths = new Path[threads];
+    pool.found = new int[threads];
+
+    // thread 0 is the caller
+    pool.workers = new thread[threads - 1];
+    for (int k = 1; k < threads; k++) pool.workers[k - 1] = thread(HintWorker, ref(pool), k);
+}
+
+void DeleteHintPool(HintPool &pool) {
+    {
+        lock_guard<mutex> lock(pool.lock);
+        pool.quit = true;
+    }
+    pool.wake.notify_all();
+
+    for (int k = 1; k < pool.threads; k++) pool.workers[k - 1].join();
+
+    delete [] pool.workers;
+    delete [] pool.paths;
+    delete [] pool.found;
+
+    pool.workers = NULL;
+    pool.paths = NULL;
+    pool.found = NULL;
+    pool.threads = 0;
+    pool.round = 0;
+    pool.quit = false;
+}
+
+bool FindHintParallel(HintPool &pool, Occupancy &occ, SymbolIndex &index, Path &path) {
+    pool.occ = &occ;
+    pool.index = &index;
+    pool.best = INT_MAX;
+
+    {
+        lock_guard<mutex> lock(pool.lock);
+        pool.running = pool.threads - 1;
+        ++pool.round;
+    }
+    pool.wake.notify_all();
+
+    SearchHint(pool, 0);
+
+    {
+        unique_lock<mutex> lock(pool.lock);
+        while (pool.running > 0) pool.done.wait(lock);
+    }
+
+    // the lowest pair, the one FindHint would give
+    int bestThread = -1;
+    for (int k = 0; k < pool.threads; k++) {
+        if (pool.found[k] != INT_MAX && (bestThread == -1 || pool.found[k] < pool.found[bestThread])) bestThread = k;
+    }
+
+    if (bestThread == -1) return false;
+
+    path = pool.paths[bestThread];
+    return true;
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "../core/pos.hpp"
+#include "../core/status-bits.hpp"
+#include "../core/occupancy.hpp"
+#include "../core/pathfinder.hpp"
+#include "../core/symbol-index.hpp"
+#include "../core/move-set.hpp"
+#include "../core/generator.hpp"
+#include "../core/random.hpp"
+#include "../core/solver.hpp"
+
+#include <random>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// Rules of the game, without any display: boards, paths, hints, removing and sliding.
+// Nothing here touches curses, so it also builds on its own (see src/bench)
+
+#define MODE_NORMAL 0 //standard mode
+#define MODE_DIFFICULT 1
+
+// min = 0, the higher num the less random the board is
+#define NON_RANDOMNESS 1
+
+// symbols of the cards are the letters from 'A'
+#define NUM_LETTERS 26
+
+// The game works on any storage of the cards (the Board of the templates below).
+// A storage is a struct holding its height, width and a StatusBits status (the status of
+// every card, so removing a card is the same for all of them), plus these functions:
+//
+//   void CreateBoard(Board &board, int height, int width);
+//   void DeleteBoard(Board &board);
+//   // symbols: height * width symbols row by row
+//   void LoadSymbols(Board &board, char *symbols);
+//   // the same, with EMPTY_SYMBOL for the removed cards
+//   void GetSymbols(Board &board, char *symbols);
+//   char GetSymbol(Board &board, Pos pos);
+//   // the cards from removedPos.x + 1 to lastX move one cell to the left.
+//   // The symbol left at lastX doesn't matter anymore, nor do the ones after it
+//   // (rows are always left-packed in difficult mode, so those cells are empty)
+//   void SlideSymbols(Board &board, Pos removedPos, int lastX);
+//
+// Storages: ArrayBoard (src/pointer), ListBoard (src/linked-list), BitBoard (src/bitboard)
+
+// generator: GEN_CLASSIC or GEN_SOLVABLE, a solvable board is built for the rules of mode.
+// The same seed always gives the same symbols (height * width of them, row by row).
+// Returns false if the solvable board couldn't be built (odd sizes too), a classic one is dealt instead
+// and it may have no solution
+bool GenerateSymbols(char *symbols, int height, int width, int generator, int mode, uint64_t seed);
+
+// Path between 2 cards: p1, the corners and p2.
+// The points are stored inline so a path is a plain value, nothing to allocate or free
+struct Path {
+    Pos point[MAX_TURNS + 2];
+    int len = 0;
+};
+
+// Can the cards at p1 and p2 be removed together? path gets the way between them
+template <class Board>
+bool CheckPaths(Pos p1, Pos p2, Board &board, Occupancy &occ, Path &path) {
+    path.len = 0;
+
+    // Kiểm tra ngay hai giá trị có giống nhau hay không
+    if (GetSymbol(board, p1) != GetSymbol(board, p2)) return false;
+
+    // Tìm đường đi có tối đa MAX_TURNS lần rẽ (I, L, Z, U), ghi thẳng vào path
+    return FindPath(p1, p2, occ, path.point, path.len);
+}
+
+// first pair that can be removed, searched in the buckets of the index.
+// The game keeps its MoveSet up to date instead (engine.hpp), the bench compares both
+bool FindHint(Occupancy &occ, SymbolIndex &index, Path &path);
+
+// Threads kept waiting for the hint searches of big boards, made once and reused by every search.
+// The caller searches too, so a pool of 1 thread has no worker and is the same as FindHint
+struct HintPool {
+    int threads = 0;
+    std::thread *workers = NULL;
+
+    std::mutex lock;
+    std::condition_variable wake; // a search started, or the pool is deleted
+    std::condition_variable done; // the last worker finished its part
+    int round = 0;                // number of the current search
+    int running = 0;              // workers not done with it
+    bool quit = false;
+
+    // the current search, only read by the workers
+    Occupancy *occ = NULL;
+    SymbolIndex *index = NULL;
+
+    // number of the first card of the lowest pair found so far (INT_MAX: none),
+    // the workers stop once they can't find a lower one
+    std::atomic<int> best;
+    // pair found by each thread and the number of its first card
+    Path *paths = NULL;
+    int *found = NULL;
+};
+
+// threads: 0 for one per hardware thread
+void CreateHintPool(HintPool &pool, int threads = 0);
+void DeleteHintPool(HintPool &pool);
+
+// The same pair as FindHint, the first cards of the pairs split between the threads of the pool.
+// occ and index are only read
+bool FindHintParallel(HintPool &pool, Occupancy &occ, SymbolIndex &index, Path &path);
+
+template <class Board>
+bool IsRemoved(Board &board, Pos pos) {
+    return GetStatus(board.status, pos) == STATUS_REMOVED;
+}
+
+// the symbols go into the storage, the EMPTY_SYMBOL cells (the last one of an odd board)
+// are removed from the start so nothing takes them for a card
+template <class Board>
+void LoadCards(Board &board, char *symbols) {
+    LoadSymbols(board, symbols);
+
+    for (int i = 0; i < board.height * board.width; i++) {
+        if (symbols[i] == EMPTY_SYMBOL) SetStatus(board.status, {i / board.width, i % board.width}, STATUS_REMOVED);
+    }
+}
+
+template <class Board>
+bool GenerateBoard(Board &board, int height, int width, int generator, int mode, uint64_t seed) {
+    char *symbols = new char[height * width];
+    bool built = GenerateSymbols(symbols, height, width, generator, mode, seed);
+
+    CreateBoard(board, height, width);
+    LoadCards(board, symbols);
+
+    delete [] symbols;
+    return built;
+}
+
+// fill the occupancy with the cards still on the board
+template <class Board>
+void BuildOccupancy(Occupancy &occ, Board &board, int height, int width) {
+    CreateOccupancy(occ, height, width);
+
+    for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+            if (!IsRemoved(board, {i, j})) SetOccupied(occ, {i, j}, true);
+        }
+    }
+}
+
+// group the cards still on the board by symbol
+template <class Board>
+void BuildSymbolIndex(SymbolIndex &index, Board &board, int height, int width) {
+    char *symbols = new char[height * width];
+    GetSymbols(board, symbols);
+
+    CreateSymbolIndex(index, symbols, height, width);
+
+    delete [] symbols;
+}
+
+// Can every card be removed with the rules of mode (MODE_NORMAL / MODE_DIFFICULT)?
+// Returns a SOLVE_ result, on SOLVE_CLEARED solution holds the pairs to remove in order
+// (room for height * width / 2 moves)
+template <class Board>
+int SolveBoard(Board &board, int height, int width, int mode, Move *solution, int &solutionLen) {
+    char *symbols = new char[height * width];
+    GetSymbols(board, symbols);
+
+    int result = SolveBoard(symbols, height, width, mode == MODE_DIFFICULT, solution, solutionLen);
+
+    delete [] symbols;
+    return result;
+}
+
+// the pair leaves the board
+template <class Board>
+void RemoveCards(Board &board, Occupancy &occ, SymbolIndex &index, Pos *pair) {
+    for (int i = 0; i < 2; i++) {
+        SetStatus(board.status, pair[i], STATUS_REMOVED);
+        SetOccupied(occ, pair[i], false);
+        RemoveFromIndex(index, pair[i]);
+    }
+}
+
+// difficult mode, slide the cards right of removedPos one cell to the left.
+// Returns the x of the cell left empty at the end of the row (removedPos.x if nothing moved)
+template <class Board>
+int SlideCards(Board &board, Occupancy &occ, SymbolIndex &index, int boardWidth, Pos removedPos) {
+    int y = removedPos.y;
+    int x = removedPos.x + 1;
+
+    if (x == (boardWidth) || IsRemoved(board, {y, x})) return removedPos.x;
+
+    // the cards from x to lastX slide one cell to the left
+    int lastX = x;
+    while (lastX + 1 < boardWidth && !IsRemoved(board, {y, lastX + 1})) ++lastX;
+
+    // the storage moves the symbols, status stays by position
+    SlideSymbols(board, removedPos, lastX);
+
+    // passing status of a card from  right to left
+    for (; x <= lastX; x++) {
+        SetStatus(board.status, {y, x - 1}, GetStatus(board.status, {y, x}));
+        MoveInIndex(index, {y, x}, {y, x - 1});
+    }
+
+    // remove the last one after sliding
+    SetStatus(board.status, {y, lastX}, STATUS_REMOVED);
+
+    // only the two ends of the slided cards change
+    SetOccupied(occ, removedPos, true);
+    SetOccupied(occ, {y, lastX}, false);
+
+    return lastX;
+}
+
+// slide after both cards of pair are removed, the one on the right first
+// because SlideCards only works with rows having 1 removed card
+template <class Board>
+void SlidePair(Board &board, Occupancy &occ, SymbolIndex &index, int boardWidth, Pos *pair) {
+    Pos posL = pair[0];
+    Pos posR = pair[1];
+
+    if (posL.x > posR.x) std::swap(posL, posR);
+
+    SlideCards(board, occ, index, boardWidth, posR);
+    SlideCards(board, occ, index, boardWidth, posL);
+}
@@ -0,0 +1,332 @@
+#include "view.hpp"
+#include "path.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+void MarkDirty(Dirty &dirty, Rect rect) {
+    if (dirty.all) return;
+
+    if (dirty.count == MAX_DIRTY_RECTS) {
+        MarkAllDirty(dirty);
+        return;
+    }
+
+    dirty.rects[dirty.count++] = rect;
+}
+
+void MarkAllDirty(Dirty &dirty) {
+    dirty.all = true;
+    dirty.count = 0;
+}
+
+void ClearDirty(Dirty &dirty) {
+    dirty.all = false;
+    dirty.count = 0;
+}
+
+void CreateBoardView(BoardView &view, int height, int width, int screenHeight, int screenWidth) {
+    view.height = height;
+    view.width = width;
+    view.rows = height * CARD_HEIGHT + (height - 1) * CARD_SPACE / 2;
+    view.cols = width * CARD_WIDTH + (width - 1) * CARD_SPACE;
+
+    view.screenHeight = screenHeight;
+    view.screenWidth = screenWidth;
+    view.y = (screenHeight - view.rows) / 2;
+    view.x = (screenWidth - view.cols) / 2;
+
+    view.layout = new Rect[height * width];
+    view.shown = new bool[height * width]();
+
+    MarkAllDirty(view.dirty);
+
+    for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+            // Because char's height is about double the width so i divide the spacing by 2
+            Rect &rect = view.layout[i * width + j];
+            rect.y = i * (CARD_HEIGHT + CARD_SPACE / 2);
+            rect.x = j * (CARD_WIDTH + CARD_SPACE);
+            rect.height = CARD_HEIGHT;
+            rect.width = CARD_WIDTH;
+        }
+    }
+}
+
+void DeleteBoardView(BoardView &view) {
+    if (view.display.close) view.display.close(view.display.data);
+    view.display = Display();
+
+    delete [] view.layout;
+    delete [] view.shown;
+
+    view.layout = NULL;
+    view.shown = NULL;
+    view.height = view.width = 0;
+    view.anims.count = 0;
+}
+
+Rect &GetRect(BoardView &view, Pos pos) {
+    return view.layout[pos.y * view.width + pos.x];
+}
+
+Rect GetScreenRect(BoardView &view, Pos pos) {
+    Rect rect = GetRect(view, pos);
+    rect.y += view.y;
+    rect.x += view.x;
+
+    return rect;
+}
+
+void ShowCard(BoardView &view, Pos pos) {
+    view.display.show(view.display.data, LAYER_BOARD, GetRect(view, pos));
+}
+
+// color of the inside of a card, the symbol keeps its char
+void PaintCard(BoardView &view, Pos pos, int colorPair) {
+    Rect &rect = GetRect(view, pos);
+    Display &display = view.display;
+
+    for (int i = 1; i < rect.height - 1; i++) {
+        display.recolor(display.data, LAYER_BOARD, rect.y + i, rect.x + 1, rect.width - 2, colorPair);
+    }
+}
+
+void DisplayCard(BoardView &view, Pos pos, char symbol) {
+    Rect &rect = GetRect(view, pos);
+    Display &display = view.display;
+    void *data = display.data;
+
+    int bottom = rect.y + rect.height - 1;
+    int right = rect.x + rect.width - 1;
+
+    // border
+    display.put(data, LAYER_BOARD, rect.y, rect.x, CELL_ULCORNER, 0);
+    display.put(data, LAYER_BOARD, rect.y, right, CELL_URCORNER, 0);
+    display.put(data, LAYER_BOARD, bottom, rect.x, CELL_LLCORNER, 0);
+    display.put(data, LAYER_BOARD, bottom, right, CELL_LRCORNER, 0);
+
+    for (int x = rect.x + 1; x < right; x++) {
+        display.put(data, LAYER_BOARD, rect.y, x, CELL_HLINE, 0);
+        display.put(data, LAYER_BOARD, bottom, x, CELL_HLINE, 0);
+    }
+
+    for (int y = rect.y + 1; y < bottom; y++) {
+        display.put(data, LAYER_BOARD, y, rect.x, CELL_VLINE, 0);
+        display.put(data, LAYER_BOARD, y, right, CELL_VLINE, 0);
+
+        // inside
+        for (int x = rect.x + 1; x < right; x++) display.put(data, LAYER_BOARD, y, x, ' ', 0);
+    }
+
+    // the symbol in the middle
+    display.put(data, LAYER_BOARD, rect.y + 1 + (CARD_HEIGHT - 2 - 1) / 2, rect.x + 1 + (CARD_WIDTH - 2 - 1) / 2, symbol, 0);
+
+    ShowCard(view, pos);
+
+    view.shown[pos.y * view.width + pos.x] = true;
+}
+
+void EmptyCard(BoardView &view, Pos pos) {
+    Rect &rect = GetRect(view, pos);
+    Display &display = view.display;
+
+    for (int i = 0; i < rect.height; i++) {
+        for (int j = 0; j < rect.width; j++) display.put(display.data, LAYER_BOARD, rect.y + i, rect.x + j, ' ', 0);
+    }
+
+    view.shown[pos.y * view.width + pos.x] = false;
+
+    // what is under the board shows there again from the next frame
+    MarkDirty(view.dirty, GetScreenRect(view, pos));
+}
+
+// the fade of the card at pos is dropped, not done
+void CancelFade(BoardView &view, Pos pos) {
+    Animations &anims = view.anims;
+
+    for (int i = 0; i < anims.count; i++) {
+        Animation &task = anims.tasks[i];
+        if (task.type != ANIM_FADE || task.pos.y != pos.y || task.pos.x != pos.x) continue;
+
+        for (int j = i + 1; j < anims.count; j++) anims.tasks[j - 1] = anims.tasks[j];
+        --anims.count;
+        return;
+    }
+}
+
+void FadeCard(BoardView &view, Pos pos, char symbol) {
+    CancelFade(view, pos);
+
+    if (view.anims.ms == 0) {
+        EmptyCard(view, pos);
+        return;
+    }
+
+    // the symbol stays, painted like the paths. It's drawn again:
+    // at the end of a slid row the cell still holds the card that slid away
+    DisplayCard(view, pos, symbol);
+    PaintCard(view, pos, 2);
+    ShowCard(view, pos);
+
+    Animation task;
+    task.type = ANIM_FADE;
+    task.pos = pos;
+
+    Animate(view, task);
+}
+
+void DrawGameEvent(GameEvent &event, void *data) {
+    BoardView &view = *(BoardView *)data;
+
+    switch (event.type) {
+        case EV_STATUS:
+            // selected cards keep the highlight
+            if (event.status == STATUS_SELECTED) break;
+
+            PaintCard(view, event.pos, event.status == STATUS_HIGHLIGHTED ? 1 : 0);
+            ShowCard(view, event.pos);
+            break;
+
+        case EV_REMOVED:
+            FadeCard(view, event.pos, event.symbol);
+            break;
+
+        case EV_MOVED:
+            // a card slid in where one was fading
+            CancelFade(view, event.pos);
+            DisplayCard(view, event.pos, event.symbol);
+            break;
+    }
+}
+
+void DrawFrame(BoardView &view) {
+    Dirty &dirty = view.dirty;
+    Display &display = view.display;
+
+    if (!dirty.all && dirty.count == 0) return;
+
+    // the paths still shown may be erased by the rows painted again, so they're painted again whole
+    for (int i = 0; i < view.anims.count; i++) {
+        Animation &task = view.anims.tasks[i];
+        if (task.type != ANIM_PATH) continue;
+
+        for (int j = 0; j < task.lineCount; j++) MarkDirty(dirty, task.lines[j]);
+    }
+
+    if (dirty.all) {
+        display.restore(display.data, {0, 0, view.screenHeight, view.screenWidth});
+    } else {
+        for (int i = 0; i < dirty.count; i++) display.restore(display.data, dirty.rects[i]);
+    }
+
+    // what is under the board may come back by whole rows, so do the cards on the rows painted again
+    for (int i = 0; i < view.height; i++) {
+        for (int j = 0; j < view.width; j++) {
+            if (!view.shown[i * view.width + j]) continue;
+
+            Rect rect = GetScreenRect(view, {i, j});
+
+            bool painted = dirty.all;
+            for (int k = 0; k < dirty.count && !painted; k++) {
+                Rect &area = dirty.rects[k];
+                painted = rect.y < area.y + area.height && area.y < rect.y + rect.height;
+            }
+
+            if (painted) ShowCard(view, {i, j});
+        }
+    }
+
+    for (int i = 0; i < view.anims.count; i++) {
+        Animation &task = view.anims.tasks[i];
+        if (task.type == ANIM_PATH) DrawPath(view, view.height, view.width, task.path, task.lines);
+    }
+
+    ClearDirty(dirty);
+}
+
+void EndFrame(BoardView &view, const char *name) {
+    view.display.endFrame(view.display.data, name);
+}
+
+// Null backend
+
+void NullPut(void *, int, int, int, int, int) {}
+void NullRecolor(void *, int, int, int, int, int) {}
+void NullShow(void *, int, Rect) {}
+void NullRestore(void *, Rect) {}
+void NullEndFrame(void *, const char *) {}
+void NullClose(void *) {}
+
+void UseNullDisplay(Display &display) {
+    display.data = NULL;
+    display.put = NullPut;
+    display.recolor = NullRecolor;
+    display.show = NullShow;
+    display.restore = NullRestore;
+    display.endFrame = NullEndFrame;
+    display.close = NullClose;
+}
+
+// Animations
+
+long long AnimationClock() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// what's left when it's done
+void EndAnimation(BoardView &view, Animation &task) {
+    switch (task.type) {
+        case ANIM_PATH:
+            for (int i = 0; i < task.lineCount; i++) MarkDirty(view.dirty, task.lines[i]);
+            break;
+
+        case ANIM_FADE:
+            EmptyCard(view, task.pos);
+            break;
+    }
+}
+
+void Animate(BoardView &view, Animation &task) {
+    Animations &anims = view.anims;
+
+    if (anims.ms == 0 || anims.count == MAX_ANIMATIONS) {
+        EndAnimation(view, task);
+        return;
+    }
+
+    task.due = AnimationClock() + anims.ms;
+    anims.tasks[anims.count++] = task;
+}
+
+bool RunAnimations(BoardView &view, long long now) {
+    Animations &anims = view.anims;
+
+    // the ones left keep their order
+    int left = 0;
+    for (int i = 0; i < anims.count; i++) {
+        if (anims.tasks[i].due <= now) EndAnimation(view, anims.tasks[i]);
+        else anims.tasks[left++] = anims.tasks[i];
+    }
+
+    bool ran = left < anims.count;
+    anims.count = left;
+
+    return ran;
+}
+
+void FinishAnimations(BoardView &view) {
+    for (int i = 0; i < view.anims.count; i++) EndAnimation(view, view.anims.tasks[i]);
+    view.anims.count = 0;
+}
+
+int NextAnimation(BoardView &view, long long now) {
+    if (view.anims.count == 0) return -1;
+
+    long long due = view.anims.tasks[0].due;
+    for (int i = 1; i < view.anims.count; i++) due = min(due, view.anims.tasks[i].due);
+
+    return int(max(due - now, 0LL));
+}
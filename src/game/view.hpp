@@ -0,0 +1,161 @@
+#pragma once
+
+#include "engine.hpp"
+
+// The board as it's shown: where each card goes and what changed since the last frame.
+// Nothing here touches curses, everything is drawn through a Display backend:
+//   curses:  CreateCursesDisplay (frame.hpp), PDCurses on windows, ncurses on linux
+//   virtual: CreateVirtualScreen (virtual-screen.hpp), cells kept in memory and counted
+//   null:    UseNullDisplay, draws nothing
+
+#define CARD_WIDTH 5
+#define CARD_HEIGHT 3
+#define CARD_SPACE 1
+
+// Where a card is drawn, from the top left of the board
+struct Rect {
+    int y, x;
+    int height, width;
+};
+
+// boards drawn with more changes than this in a frame are painted again whole
+#define MAX_DIRTY_RECTS 32
+
+// Screen rects changed since the last frame (paths, emptied cards, prompts)
+struct Dirty {
+    Rect rects[MAX_DIRTY_RECTS];
+    int count = 0;
+
+    // everything has to be painted again (first frame, too many rects)
+    bool all = true;
+};
+
+void MarkDirty(Dirty &dirty, Rect rect);
+void MarkAllDirty(Dirty &dirty);
+void ClearDirty(Dirty &dirty);
+
+#define LAYER_BOARD 0   // the cards, from the top left of the board
+#define LAYER_OVERLAY 1 // above everything (the paths), from the top left of the screen
+
+// line chars, every backend draws them its own way
+#define CELL_HLINE 256
+#define CELL_VLINE 257
+#define CELL_ULCORNER 258
+#define CELL_URCORNER 259
+#define CELL_LLCORNER 260
+#define CELL_LRCORNER 261
+
+// Animations: timed changes of the view, done by RunAnimations once their time has come.
+// The game goes on meanwhile, they only change what is shown
+#define ANIM_PATH 0 // a path over the board, erased when done
+#define ANIM_FADE 1 // a removed card painted faded, emptied when done
+
+// more at once than this and the new ones are done right away
+#define MAX_ANIMATIONS 64
+
+// lines of a path, one less than its points
+#define MAX_PATH_LINES (MAX_TURNS + 1)
+
+struct Animation {
+    int type;
+
+    // ms of AnimationClock when it's done
+    long long due;
+
+    // ANIM_FADE: the card
+    Pos pos;
+
+    // ANIM_PATH: the path and the screen rects of its lines
+    Path path;
+    Rect lines[MAX_PATH_LINES];
+    int lineCount = 0;
+};
+
+struct Animations {
+    Animation tasks[MAX_ANIMATIONS];
+    int count = 0;
+
+    // how long paths and removed cards stay, 0: they go at once
+    int ms = 0;
+};
+
+// A display backend, data is its own state. color is a color pair (0: normal)
+struct Display {
+    void *data = NULL;
+
+    // one cell of a layer
+    void (*put)(void *data, int layer, int y, int x, int ch, int color) = NULL;
+    // color of n cells from y, x, the chars stay
+    void (*recolor)(void *data, int layer, int y, int x, int n, int color) = NULL;
+    // the rect of the layer goes to the screen with the next frame
+    void (*show)(void *data, int layer, Rect rect) = NULL;
+    // screen rect: the overlay is erased there and what is under the board painted again
+    void (*restore)(void *data, Rect rect) = NULL;
+    // push everything shown to the terminal, name: what the frame was for
+    void (*endFrame)(void *data, const char *name) = NULL;
+    void (*close)(void *data) = NULL;
+};
+
+// Every card at its rect of the layout (row by row).
+// Owned by the display, the game state never touches it
+struct BoardView {
+    int height = 0, width = 0;
+
+    // size of the board and of the whole screen, in cells
+    int rows = 0, cols = 0;
+    int screenHeight = 0, screenWidth = 0;
+
+    // screen pos of the top left of the board
+    int y = 0, x = 0;
+
+    Rect *layout = NULL;
+
+    // cards drawn, the others are empty
+    bool *shown = NULL;
+
+    Dirty dirty;
+    Display display;
+
+    Animations anims;
+};
+
+// the board is centered on the screen, the display is set after (view.display)
+void CreateBoardView(BoardView &view, int height, int width, int screenHeight, int screenWidth);
+// closes the display too
+void DeleteBoardView(BoardView &view);
+
+Rect &GetRect(BoardView &view, Pos pos);
+Rect GetScreenRect(BoardView &view, Pos pos);
+
+// Cards are drawn on the board layer, then only marked to be shown
+void ShowCard(BoardView &view, Pos pos);
+void PaintCard(BoardView &view, Pos pos, int colorPair);
+void DisplayCard(BoardView &view, Pos pos, char symbol);
+// the card is blanked and its rect marked dirty
+void EmptyCard(BoardView &view, Pos pos);
+// the removed card symbol at pos, faded for anims.ms before it's emptied
+void FadeCard(BoardView &view, Pos pos, char symbol);
+
+// Draws the changes of a game, data is the BoardView of the game:
+// Subscribe(game, DrawGameEvent, &view)
+void DrawGameEvent(GameEvent &event, void *data);
+
+// Paint again what is marked dirty since the last frame: what is under the board,
+// then the cards over it and the paths still animated. It's only marked, the frame is pushed by endFrame
+void DrawFrame(BoardView &view);
+
+void EndFrame(BoardView &view, const char *name);
+
+void UseNullDisplay(Display &display);
+
+// ms from a steady clock, for the due time of animations
+long long AnimationClock();
+
+// starts the task (due is set here), done at once if anims.ms is 0 or there are too many
+void Animate(BoardView &view, Animation &task);
+// done the animations due at now, false if there was none
+bool RunAnimations(BoardView &view, long long now);
+// done every animation, whatever its time
+void FinishAnimations(BoardView &view);
+// ms from now to the next animation due, -1 if there is none
+int NextAnimation(BoardView &view, long long now);
@@ -0,0 +1,154 @@
+#include "virtual-screen.hpp"
+
+#include <algorithm>
+
+using namespace std;
+
+bool SameCell(Cell &a, Cell &b) {
+    return a.ch == b.ch && a.color == b.color;
+}
+
+// layer cell at y, x, NULL outside of the layer
+Cell *GetLayerCell(VirtualScreen &screen, int layer, int y, int x) {
+    if (layer == LAYER_BOARD) {
+        if (y < 0 || screen.boardRows <= y || x < 0 || screen.boardCols <= x) return NULL;
+        return &screen.board[y * screen.boardCols + x];
+    }
+
+    if (y < 0 || screen.height <= y || x < 0 || screen.width <= x) return NULL;
+    return &screen.overlay[y * screen.width + x];
+}
+
+void VirtualPut(void *data, int layer, int y, int x, int ch, int color) {
+    VirtualScreen &screen = *(VirtualScreen *)data;
+    ++screen.stats.puts;
+
+    Cell *cell = GetLayerCell(screen, layer, y, x);
+    if (cell == NULL) return;
+
+    cell->ch = ch;
+    cell->color = color;
+}
+
+void VirtualRecolor(void *data, int layer, int y, int x, int n, int color) {
+    VirtualScreen &screen = *(VirtualScreen *)data;
+    ++screen.stats.recolors;
+
+    for (int i = 0; i < n; i++) {
+        Cell *cell = GetLayerCell(screen, layer, y, x + i);
+        if (cell) cell->color = color;
+    }
+}
+
+void VirtualShow(void *data, int layer, Rect rect) {
+    VirtualScreen &screen = *(VirtualScreen *)data;
+    ++screen.stats.shows;
+
+    // the rect in screen pos
+    int offsetY = layer == LAYER_BOARD ? screen.boardY : 0;
+    int offsetX = layer == LAYER_BOARD ? screen.boardX : 0;
+
+    for (int y = rect.y; y < rect.y + rect.height; y++) {
+        for (int x = rect.x; x < rect.x + rect.width; x++) {
+            Cell *cell = GetLayerCell(screen, layer, y, x);
+            if (cell == NULL) continue;
+
+            int screenY = y + offsetY;
+            int screenX = x + offsetX;
+            if (screenY < 0 || screen.height <= screenY || screenX < 0 || screen.width <= screenX) continue;
+
+            // the overlay only has what is drawn on it
+            if (layer == LAYER_OVERLAY && cell->ch == ' ') continue;
+
+            screen.screen[screenY * screen.width + screenX] = *cell;
+        }
+    }
+}
+
+void VirtualRestore(void *data, Rect rect) {
+    VirtualScreen &screen = *(VirtualScreen *)data;
+    ++screen.stats.restores;
+
+    // nothing under the board here, the cells are blank again
+    for (int y = max(rect.y, 0); y < min(rect.y + rect.height, screen.height); y++) {
+        for (int x = max(rect.x, 0); x < min(rect.x + rect.width, screen.width); x++) {
+            screen.overlay[y * screen.width + x] = Cell();
+            screen.screen[y * screen.width + x] = Cell();
+        }
+    }
+}
+
+void VirtualEndFrame(void *data, const char *) {
+    VirtualScreen &screen = *(VirtualScreen *)data;
+    ++screen.stats.frames;
+
+    for (int i = 0; i < screen.height * screen.width; i++) {
+        if (SameCell(screen.screen[i], screen.pushed[i])) continue;
+
+        screen.pushed[i] = screen.screen[i];
+        ++screen.stats.cellsChanged;
+    }
+}
+
+void VirtualClose(void *data) {
+    VirtualScreen *screen = (VirtualScreen *)data;
+
+    delete [] screen->board;
+    delete [] screen->overlay;
+    delete [] screen->screen;
+    delete [] screen->pushed;
+    delete screen;
+}
+
+void CreateVirtualScreen(Display &display, BoardView &view) {
+    VirtualScreen *screen = new VirtualScreen;
+
+    screen->height = view.screenHeight;
+    screen->width = view.screenWidth;
+    screen->boardY = view.y;
+    screen->boardX = view.x;
+    screen->boardRows = view.rows;
+    screen->boardCols = view.cols;
+
+    screen->board = new Cell[view.rows * view.cols];
+    screen->overlay = new Cell[screen->height * screen->width];
+    screen->screen = new Cell[screen->height * screen->width];
+    screen->pushed = new Cell[screen->height * screen->width];
+
+    display.data = screen;
+    display.put = VirtualPut;
+    display.recolor = VirtualRecolor;
+    display.show = VirtualShow;
+    display.restore = VirtualRestore;
+    display.endFrame = VirtualEndFrame;
+    display.close = VirtualClose;
+}
+
+VirtualScreen &GetVirtualScreen(Display &display) {
+    return *(VirtualScreen *)display.data;
+}
+
+Cell GetScreenCell(VirtualScreen &screen, int y, int x) {
+    return screen.pushed[y * screen.width + x];
+}
+
+void DumpVirtualScreen(VirtualScreen &screen, FILE *file) {
+    for (int y = 0; y < screen.height; y++) {
+        for (int x = 0; x < screen.width; x++) {
+            int ch = GetScreenCell(screen, y, x).ch;
+
+            switch (ch) {
+                case CELL_HLINE: ch = '-'; break;
+                case CELL_VLINE: ch = '|'; break;
+                case CELL_ULCORNER:
+                case CELL_URCORNER:
+                case CELL_LLCORNER:
+                case CELL_LRCORNER: ch = '+'; break;
+            }
+
+            fputc(ch, file);
+        }
+
+        fputc('\n', file);
+    }
+}
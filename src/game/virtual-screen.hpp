@@ -0,0 +1,54 @@
+#pragma once
+
+#include "view.hpp"
+
+#include <cstdio>
+
+// Virtual backend of a BoardView: a screen in memory, no terminal needed.
+// It keeps the cells the terminal would show and counts what the view asked for,
+// so rendering can be measured (src/bench) and frames compared with each other
+
+struct Cell {
+    int ch = ' ';
+    int color = 0;
+};
+
+struct ScreenStats {
+    long long puts = 0;
+    long long recolors = 0;
+    long long shows = 0;
+    long long restores = 0;
+    long long frames = 0;
+
+    // cells of the screen that differ from the last frame, summed over the frames
+    // (what a terminal would have to be sent)
+    long long cellsChanged = 0;
+};
+
+struct VirtualScreen {
+    int height = 0, width = 0;
+
+    // screen pos of the board layer
+    int boardY = 0, boardX = 0;
+    int boardRows = 0, boardCols = 0;
+
+    Cell *board = NULL;
+    Cell *overlay = NULL;
+
+    // what the next frame shows, and what the last one showed
+    Cell *screen = NULL;
+    Cell *pushed = NULL;
+
+    ScreenStats stats;
+};
+
+// the screen has the size of the screen of the view
+void CreateVirtualScreen(Display &display, BoardView &view);
+
+VirtualScreen &GetVirtualScreen(Display &display);
+
+// cell shown by the last frame
+Cell GetScreenCell(VirtualScreen &screen, int y, int x);
+
+// the chars of the last frame, lines drawn with - | +
+void DumpVirtualScreen(VirtualScreen &screen, FILE *file);
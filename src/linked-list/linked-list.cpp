@@ -1,67 +1,114 @@
 #include "linked-list.hpp"
 
+#include <new>
+
+long long nodeAllocations = 0;
+
+void DeleteArena(NodeArena &arena) {
+    while (arena.slabs) {
+        char *temp = arena.slabs;
+        arena.slabs = *(char **)temp;
+
+        delete [] temp;
+    }
+
+    arena.top = arena.end = NULL;
+    arena.freeNodes = NULL;
+}
+
+long long GetNodeAllocations() {
+    return nodeAllocations;
+}
+
+// take size bytes from the newest slab, a new slab is made when it's full
+void *ArenaAlloc(NodeArena &arena, int size) {
+    // keep every block aligned like new would
+    const int align = alignof(max_align_t);
+    size = (size + align - 1) / align * align;
+
+    if (arena.top == NULL || arena.end - arena.top < size) {
+        char *slab = new char[ARENA_SLAB_BYTES];
+        nodeAllocations++;
+
+        *(char **)slab = arena.slabs;
+        arena.slabs = slab;
+        arena.top = slab + align;
+        arena.end = slab + ARENA_SLAB_BYTES;
+    }
+
+    void *block = arena.top;
+    arena.top += size;
+
+    return block;
+}
+
+void FreeNode(NodeArena *arena, Node *currNode) {
+    if (arena == NULL) {
+        delete currNode;
+        return;
+    }
+
+    currNode->next = arena->freeNodes;
+    arena->freeNodes = currNode;
+}
+
 bool IsEmpty(List &currList) {
     if (currList.head == NULL && currList.tail == NULL) return true;
     return false;
 }
 
-bool IsEmpty(Path &currPath) {
-    if (currPath.head == NULL && currPath.tail == NULL) return true;
-    return false;
-}
+Node *CreateNode(NodeArena *arena, Card newData) {
+    Node *newNode;
+
+    if (arena == NULL) {
+        newNode = new Node;
+        nodeAllocations++;
+    } else if (arena->freeNodes) {
+        newNode = arena->freeNodes;
+        arena->freeNodes = newNode->next;
+        newNode = new (newNode) Node;
+    } else {
+        newNode = new (ArenaAlloc(*arena, sizeof(Node))) Node;
+    }
 
-Node *CreateNode(Card newData) {
-    Node *newNode = new Node;
     newNode->data = newData;
     
     return newNode;
 }
 
-pointNode *CreateNode(Pos newData) {
-    pointNode *newPNode = new pointNode;
-    newPNode->data = newData;
-    
-    return newPNode;
-}
-
 int GetLength(List &currList) {
-    int count = 0;
-    Node *currNode = currList.head;
-
-    while(currNode) {
-        currNode = currNode->next;
-        ++count;
-    }
-
-    return count;
+    return currList.size;
 }
 
-Node *GetNode(List currList, int pos) {
-    Node *currNode = currList.head;
+// put node at pos of the index, the nodes after it move one place
+void InsertIndex(List &currList, int pos, Node *node) {
+    if (currList.size == currList.capacity) {
+        int capacity = currList.capacity ? currList.capacity * 2 : 8;
+        Node **index = new Node*[capacity];
 
-    if (pos < 0) return NULL;
-    if (pos == 0) return currList.head;
+        for (int i = 0; i < currList.size; i++) index[i] = currList.index[i];
 
-    for (int i = 1; i < pos + 1; i++) {
-        if (!currNode->next) return NULL;
-        currNode = currNode->next;
+        delete [] currList.index;
+        currList.index = index;
+        currList.capacity = capacity;
     }
 
-    return currNode;
-}
+    for (int i = currList.size; i > pos; i--) currList.index[i] = currList.index[i - 1];
 
-pointNode *GetNode(Path currPath, int pos) {
-    pointNode *currPNode = currPath.head;
+    currList.index[pos] = node;
+    ++currList.size;
+}
 
-    if (pos < 0) return NULL;
-    if (pos == 0) return currPath.head;
+// take the node at pos out of the index
+void EraseIndex(List &currList, int pos) {
+    --currList.size;
+    for (int i = pos; i < currList.size; i++) currList.index[i] = currList.index[i + 1];
+}
 
-    for (int i = 1; i < pos + 1; i++) {
-        if (!currPNode->next) return NULL;
-        currPNode = currPNode->next;
-    }
+Node *GetNode(List currList, int pos) {
+    if (pos < 0 || pos >= currList.size) return NULL;
 
-    return currPNode;
+    return currList.index[pos];
 }
 
 Node *GetNode(List *board, Pos currPos) {
@@ -69,27 +116,36 @@ Node *GetNode(List *board, Pos currPos) {
 }
 
 void Push(List &currList, Card newData) {
-    Node *newNode = CreateNode(newData);
+    Node *newNode = CreateNode(currList.arena, newData);
 
     newNode->next = currList.head;
+    if (IsEmpty(currList)) currList.tail = newNode;
     currList.head = newNode;
 
-    if (IsEmpty(currList)) currList.tail = newNode;
+    InsertIndex(currList, 0, newNode);
 }
 
 void InsertAfter(List &currList, Node *currNode, Card newData) {
     if (currNode == NULL) return;
  
-    Node* newNode = CreateNode(newData);
+    Node* newNode = CreateNode(currList.arena, newData);
 
     newNode->next = currNode->next;
     currNode->next = newNode;
 
     if (currList.tail == currNode) currList.tail = newNode;
+
+    // the new node goes right after currNode in the index too
+    int pos = 0;
+    while (currList.index[pos] != currNode) ++pos;
+
+    InsertIndex(currList, pos + 1, newNode);
 }
 
 void Append(List &currList , Card newData) {
-    Node *newNode = CreateNode(newData);
+    Node *newNode = CreateNode(currList.arena, newData);
+
+    InsertIndex(currList, currList.size, newNode);
 
     if (IsEmpty(currList)) {
         currList.tail = currList.head = newNode;
@@ -100,80 +156,146 @@ void Append(List &currList , Card newData) {
     currList.tail = newNode;
 }
 
-void Append(Path &currPath, Pos newData) {
-    pointNode *newPNode = CreateNode(newData);
+void MoveNode(List &currList, int pos, int newPos) {
+    if (pos < 0 || newPos <= pos || newPos >= currList.size) return;
 
-    if (IsEmpty(currPath)) {
-        currPath.tail = currPath.head = newPNode;
-        return ;
+    Node *currNode = currList.index[pos];
+
+    if (pos == 0) {
+        currList.head = currNode->next;
+    } else {
+        currList.index[pos - 1]->next = currNode->next;
     }
 
-    currPath.tail->next = newPNode;
-    currPath.tail = newPNode;
-}
+    // splice it back right after the node at newPos, the nodes after that one don't move
+    Node *prevNode = currList.index[newPos];
+    currNode->next = prevNode->next;
+    prevNode->next = currNode;
 
-void EmpyPath(Path &currPath) {
-     pointNode *currPNode = currPath.head;
-     while (currPNode) {
-          pointNode *temp = currPNode;
-          currPNode = currPNode->next;
-          delete temp;
-     }
+    if (currList.tail == prevNode) currList.tail = currNode;
 
-    currPath.head = currPath.tail = NULL;
+    for (int i = pos; i < newPos; i++) currList.index[i] = currList.index[i + 1];
+    currList.index[newPos] = currNode;
 }
 
-bool Pop(List &currList) {
-    if (IsEmpty(currList)) return false;
+void ClearList(List &currList) {
+    Node *currNode = currList.head;
 
-    if (currList.head == currList.tail) {
-        delete currList.head;
-        currList.head = currList.tail;
+    while (currNode) {
+        Node *temp = currNode;
+        currNode = currNode->next;
 
-        return true;    
+        FreeNode(currList.arena, temp);
     }
 
-    Node *currNode = currList.head;
+    delete [] currList.index;
 
-    while (currNode->next != currList.head) {
-        currNode = currNode->next;
-    }
+    currList.head = currList.tail = NULL;
+    currList.index = NULL;
+    currList.size = currList.capacity = 0;
+}
 
-    currNode->next = NULL;
-    delete currList.tail;
-    currList.tail = currNode;
+bool Pop(List &currList) {
+    if (IsEmpty(currList)) return false;
 
-    return true;
+    return Pop(currList, currList.size - 1);
 }
 
 bool Pop(List &currList, int pos) {
     if (IsEmpty(currList)) return false;
 
-    if (pos < 0) return false;
-    if (pos == 0) {
-        Node *tempNode = currList.head->next;
-        delete currList.head;
-        currList.head = tempNode;
+    if (pos < 0 || pos >= currList.size) return false;
 
-        return true;
-    }
+    Node *currNode = currList.index[pos];
 
-    // pos > 0
-    Node *prevNode = GetNode(currList, pos - 1);
-    
-    if (!prevNode) return false;
-    if (!prevNode->next) return false;
+    // the node before it is found in the index, not by walking the list
+    if (pos == 0) {
+        currList.head = currNode->next;
+    } else {
+        currList.index[pos - 1]->next = currNode->next;
+    }
 
-    Node *currNode = prevNode->next;
+    if (currNode == currList.tail) currList.tail = pos == 0 ? NULL : currList.index[pos - 1];
 
-    if (currNode == currList.tail) return Pop(currList);
-    
-    prevNode->next = currNode->next;
-    delete currNode;
+    EraseIndex(currList, pos);
+    FreeNode(currList.arena, currNode);
 
     return true;
 }
 
 bool Pop(List *&board, Pos currPos) {
     return Pop(board[currPos.y], currPos.x); 
-}
\ No newline at end of file
+}
+
+void CreateBoard(ListBoard &board, int height, int width) {
+    board.height = height;
+    board.width = width;
+    board.rows = new List[height];
+    CreateStatusBits(board.status, height, width);
+
+    for (int i = 0; i < height; i++) board.rows[i].arena = &board.arena;
+}
+
+void DeleteBoard(ListBoard &board) {
+    // the nodes go away with the slabs of the arena, no need to walk them
+    for (int i = 0; i < board.height; i++) delete [] board.rows[i].index;
+
+    delete [] board.rows;
+    DeleteStatusBits(board.status);
+    DeleteArena(board.arena);
+
+    board.rows = NULL;
+    board.height = board.width = 0;
+}
+
+void LoadSymbols(ListBoard &board, char *symbols) {
+    for (int i = 0; i < board.height * board.width; i++) {
+        Card newCard;
+        newCard.val = symbols[i];
+        Append(board.rows[i / board.width], newCard);
+    }
+}
+
+void GetSymbols(ListBoard &board, char *symbols) {
+    for (Cursor cursor = FirstCard(board); cursor.node; NextCard(board, cursor)) {
+        bool removed = GetStatus(board.status, cursor.pos) == STATUS_REMOVED;
+        symbols[cursor.pos.y * board.width + cursor.pos.x] = removed ? EMPTY_SYMBOL : cursor.node->data.val;
+    }
+}
+
+char GetSymbol(ListBoard &board, Pos pos) {
+    return GetNode(board.rows, pos)->data.val;
+}
+
+void SlideSymbols(ListBoard &board, Pos removedPos, int lastX) {
+    MoveNode(board.rows[removedPos.y], removedPos.x, lastX);
+}
+
+Cursor FirstCard(ListBoard &board) {
+    Cursor cursor;
+    cursor.pos = {0, 0};
+    cursor.node = board.height > 0 ? board.rows[0].head : NULL;
+
+    // skip the empty rows
+    while (cursor.node == NULL && cursor.pos.y + 1 < board.height) {
+        cursor.pos.y++;
+        cursor.node = board.rows[cursor.pos.y].head;
+    }
+
+    return cursor;
+}
+
+bool NextCard(ListBoard &board, Cursor &cursor) {
+    if (cursor.node == NULL) return false;
+
+    cursor.node = cursor.node->next;
+    cursor.pos.x++;
+
+    while (cursor.node == NULL && cursor.pos.y + 1 < board.height) {
+        cursor.pos.y++;
+        cursor.pos.x = 0;
+        cursor.node = board.rows[cursor.pos.y].head;
+    }
+
+    return cursor.node != NULL;
+}
@@ -1,32 +1,69 @@
 #pragma once
 
-#include "global.hpp"
+#include "../core/pos.hpp"
+#include "../core/status-bits.hpp"
+#include "../core/symbol-index.hpp"
+
+// Symbol of a card, its status and window are kept outside of the list nodes
+struct Card {
+    char val;
+};
 
 struct Node {
     Card data;
     Node *next = NULL;
 };
 
+// Nodes of a game are cut from big slabs instead of one new per node.
+// A node given back goes to a free list and is reused first,
+// and DeleteArena releases the slabs all at once when the game ends
+#define ARENA_SLAB_BYTES 4096
+
+struct NodeArena {
+    // slabs are chained through their first bytes
+    char *slabs = NULL;
+    // free space of the newest slab
+    char *top = NULL;
+    char *end = NULL;
+
+    Node *freeNodes = NULL;
+};
+
 struct List {
     Node *head = NULL;
     Node *tail = NULL;
-};
 
-struct pointNode {
-    Pos data;
-    pointNode *next = NULL;
+    // index[i] is the node at pos i, so a node is reached without walking the list.
+    // Kept up to date by every function adding or removing a node
+    Node **index = NULL;
+    int size = 0;
+    int capacity = 0;
+
+    // nodes of the list are taken from it (NULL: straight from the heap)
+    NodeArena *arena = NULL;
 };
 
-struct Path {
-    pointNode *head = NULL;
-    pointNode *tail = NULL;
+// All the cards of a game: one list of symbols per row,
+// and the status of every card packed next to them (2 bits per card).
+// The nodes of the rows come from the arena of the board
+struct ListBoard {
+    int height = 0, width = 0;
+    List *rows = NULL;
+    StatusBits status;
+    NodeArena arena;
 };
 
-Node *CreateNode(Card newData);
-pointNode *CreatePNode(Pos newData);
+// free every slab, nodes still in a list must not be used anymore
+void DeleteArena(NodeArena &arena);
+// number of heap allocations made for nodes so far (slabs + nodes made without an arena)
+long long GetNodeAllocations();
+
+// take a node from arena (or the heap when it's NULL)
+Node *CreateNode(NodeArena *arena, Card newData);
+// give a node back to arena (or the heap when it's NULL)
+void FreeNode(NodeArena *arena, Node *currNode);
 
 int GetLength(List &currList);
-pointNode *GetNode(Path currPath, int pos);
 
 // return pointer to a node at pos of the list
 Node *GetNode(List currList, int pos);
@@ -41,11 +78,43 @@ void InsertAfter(List &currList, Node *currNode, Card newData);
 
 // Insert a node to the end of the list
 void Append(List &currList , Card newData);
-void Append(Path &currPath, Pos newData);
+
+// unlink the node at pos and put it back at newPos (after it),
+// the nodes between them move one step to the front
+void MoveNode(List &currList, int pos, int newPos);
+
+// Remove every node of the list
+void ClearList(List &currList);
 
 // Remove the last node of the list
 bool Pop(List &currList);
 // remove the node at pos of the list
 bool Pop(List &currList, int pos);
 // remvoe the node at currPos of the array of lists
-bool Pop(List *&board, Pos currPos);
\ No newline at end of file
+bool Pop(List *&board, Pos currPos);
+
+// the rows of the board take their nodes from its arena
+void CreateBoard(ListBoard &board, int height, int width);
+// free every node of the board
+void DeleteBoard(ListBoard &board);
+
+void LoadSymbols(ListBoard &board, char *symbols);
+void GetSymbols(ListBoard &board, char *symbols);
+
+char GetSymbol(ListBoard &board, Pos pos);
+
+// the removed node goes to lastX, the cards up to it move left by themselves
+void SlideSymbols(ListBoard &board, Pos removedPos, int lastX);
+
+// Walks the cards of a board in row order by following the nodes,
+// so a scan doesn't look every card up again from its position
+struct Cursor {
+    Pos pos;
+    Node *node = NULL;
+};
+
+// cursor on the first card of the board (node is NULL when there's none)
+Cursor FirstCard(ListBoard &board);
+// move to the next card, going down to the next row at the end of one.
+// return false when there's no card left
+bool NextCard(ListBoard &board, Cursor &cursor);
@@ -0,0 +1,7 @@
+#include "linked-list.hpp"
+#include "../game/play.hpp"
+
+// the linked-list build keeps every row of cards in a list
+int PlayGame(int height, int width, int mode, int generator, uint64_t seed, uint64_t boardNum, int &timeFinished) {
+    return PlayBoard<ListBoard>(height, width, mode, generator, seed, boardNum, timeFinished);
+}
@@ -0,0 +1,41 @@
+#include "array-board.hpp"
+
+using namespace std;
+
+void CreateBoard(ArrayBoard &board, int height, int width) {
+    board.height = height;
+    board.width = width;
+    board.symbols = new char[height * width];
+    CreateStatusBits(board.status, height, width);
+}
+
+void DeleteBoard(ArrayBoard &board) {
+    delete [] board.symbols;
+    DeleteStatusBits(board.status);
+
+    board.symbols = NULL;
+    board.height = board.width = 0;
+}
+
+void LoadSymbols(ArrayBoard &board, char *symbols) {
+    for (int i = 0; i < board.height * board.width; i++) board.symbols[i] = symbols[i];
+}
+
+void GetSymbols(ArrayBoard &board, char *symbols) {
+    for (int i = 0; i < board.height; i++) {
+        for (int j = 0; j < board.width; j++) {
+            bool removed = GetStatus(board.status, {i, j}) == STATUS_REMOVED;
+            symbols[i * board.width + j] = removed ? EMPTY_SYMBOL : board.symbols[i * board.width + j];
+        }
+    }
+}
+
+char GetSymbol(ArrayBoard &board, Pos pos) {
+    return board.symbols[pos.y * board.width + pos.x];
+}
+
+void SlideSymbols(ArrayBoard &board, Pos removedPos, int lastX) {
+    char *row = board.symbols + removedPos.y * board.width;
+
+    for (int x = removedPos.x + 1; x <= lastX; x++) row[x - 1] = row[x];
+}
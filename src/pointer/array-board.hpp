@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../core/pos.hpp"
+#include "../core/status-bits.hpp"
+#include "../core/symbol-index.hpp"
+
+// All the cards of a game, row by row, in parallel arrays so the game logic
+// only reads the dense ones: the symbols and their status (2 bits per card)
+struct ArrayBoard {
+    int height = 0, width = 0;
+    char *symbols = NULL;
+    StatusBits status;
+};
+
+void CreateBoard(ArrayBoard &board, int height, int width);
+void DeleteBoard(ArrayBoard &board);
+
+void LoadSymbols(ArrayBoard &board, char *symbols);
+void GetSymbols(ArrayBoard &board, char *symbols);
+
+char GetSymbol(ArrayBoard &board, Pos pos);
+
+void SlideSymbols(ArrayBoard &board, Pos removedPos, int lastX);
@@ -0,0 +1,7 @@
+#include "array-board.hpp"
+#include "../game/play.hpp"
+
+// the pointer build keeps its cards in plain arrays
+int PlayGame(int height, int width, int mode, int generator, uint64_t seed, uint64_t boardNum, int &timeFinished) {
+    return PlayBoard<ArrayBoard>(height, width, mode, generator, seed, boardNum, timeFinished);
+}
@@ -0,0 +1,78 @@
+#include "../game/engine.hpp"
+#include "../pointer/array-board.hpp"
+
+#include <cstdio>
+
+using namespace std;
+
+// Usage: hint-test
+// Games are played by FindHint until there is no pair left, and at every turn FindHintParallel
+// must give the same pair, whatever the number of threads of its pool. Exits with 1 on a failure
+
+#define TEST_SEED 1
+
+#define NUM_SIZES 2
+int sizes[NUM_SIZES][2] = {{10, 10}, {20, 20}};
+
+#define NUM_POOLS 3
+int poolThreads[NUM_POOLS] = {1, 2, 4};
+
+int failures = 0;
+
+bool SamePath(Path &a, Path &b) {
+    if (a.len != b.len) return false;
+
+    for (int i = 0; i < a.len; i++) {
+        if (a.point[i].y != b.point[i].y || a.point[i].x != b.point[i].x) return false;
+    }
+
+    return true;
+}
+
+int main() {
+    HintPool pools[NUM_POOLS];
+    for (int k = 0; k < NUM_POOLS; k++) CreateHintPool(pools[k], poolThreads[k]);
+
+    int turns = 0;
+
+    for (int i = 0; i < NUM_SIZES; i++) {
+        int height = sizes[i][0];
+        int width = sizes[i][1];
+
+        for (int mode = MODE_NORMAL; mode <= MODE_DIFFICULT; mode++) {
+            Game<ArrayBoard> game;
+            NewGame(game, height, width, mode, GEN_SOLVABLE, BoardSeed(TEST_SEED, 0));
+
+            Path path;
+            while (true) {
+                bool found = FindHint(game.occ, game.index, path);
+
+                for (int k = 0; k < NUM_POOLS; k++) {
+                    Path parallelPath;
+                    bool parallelFound = FindHintParallel(pools[k], game.occ, game.index, parallelPath);
+
+                    if (parallelFound == found && (!found || SamePath(path, parallelPath))) continue;
+
+                    printf("FAIL %dx%d %s turn %d, %d threads: not the pair of FindHint\n", height, width,
+                           mode == MODE_DIFFICULT ? "difficult" : "normal", turns, poolThreads[k]);
+                    ++failures;
+                }
+
+                if (!found) break;
+
+                Pos pair[2] = {path.point[0], path.point[path.len - 1]};
+                RemovePair(game, pair);
+                ++turns;
+            }
+
+            DeleteGame(game);
+        }
+    }
+
+    for (int k = 0; k < NUM_POOLS; k++) DeleteHintPool(pools[k]);
+
+    if (failures > 0) return 1;
+
+    printf("ok: %d turns, the same pair on every pool\n", turns);
+    return 0;
+}
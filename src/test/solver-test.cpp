@@ -0,0 +1,75 @@
+#include "../game/engine.hpp"
+#include "../pointer/array-board.hpp"
+
+#include <cstdio>
+
+using namespace std;
+
+// Usage: solver-test
+// Boards of the solvable generator must be cleared by the solver, for every size and mode of the game,
+// and the solution found must clear the board when played on the engine. Exits with 1 on a failure
+
+#define TEST_BOARDS 20
+#define TEST_SEED 1
+
+#define NUM_SIZES 3
+int sizes[NUM_SIZES][2] = {{2, 3}, {4, 6}, {6, 8}};
+
+int failures = 0;
+
+void Fail(int height, int width, int mode, int board, const char *what) {
+    printf("FAIL %dx%d %s board %d: %s\n", height, width, mode == MODE_DIFFICULT ? "difficult" : "normal", board, what);
+    ++failures;
+}
+
+// the pairs of the solution one after another, each must be a pair the game allows
+bool PlaySolution(Game<ArrayBoard> &game, Move *solution, int solutionLen) {
+    Path path;
+
+    for (int i = 0; i < solutionLen; i++) {
+        Pos pair[2] = {solution[i].p1, solution[i].p2};
+
+        if (!CheckPair(game, pair, path)) return false;
+        RemovePair(game, pair);
+    }
+
+    return IsCleared(game);
+}
+
+int main() {
+    for (int i = 0; i < NUM_SIZES; i++) {
+        int height = sizes[i][0];
+        int width = sizes[i][1];
+
+        char *symbols = new char[height * width];
+        Move *solution = new Move[height * width / 2];
+
+        for (int mode = MODE_NORMAL; mode <= MODE_DIFFICULT; mode++) {
+            for (int n = 0; n < TEST_BOARDS; n++) {
+                if (!GenerateSymbols(symbols, height, width, GEN_SOLVABLE, mode, BoardSeed(TEST_SEED, n))) {
+                    Fail(height, width, mode, n, "not built");
+                    continue;
+                }
+
+                Game<ArrayBoard> game;
+                LoadGame(game, height, width, mode, symbols);
+
+                int solutionLen;
+                int result = SolveBoard(game.board, height, width, mode, solution, solutionLen);
+
+                if (result != SOLVE_CLEARED) Fail(height, width, mode, n, result == SOLVE_STUCK ? "stuck" : "gave up");
+                else if (!PlaySolution(game, solution, solutionLen)) Fail(height, width, mode, n, "solution doesn't clear it");
+
+                DeleteGame(game);
+            }
+        }
+
+        delete [] symbols;
+        delete [] solution;
+    }
+
+    if (failures > 0) return 1;
+
+    printf("ok: %d solvable boards cleared\n", NUM_SIZES * 2 * TEST_BOARDS);
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include "../game/view.hpp"
+#include "../game/virtual-screen.hpp"
+#include "../pointer/array-board.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+// Usage: virtual-screen-test
+// A small board is drawn through the virtual display and every frame is compared with the one expected,
+// char by char (lines as DumpVirtualScreen writes them). Exits with 1 on a difference
+
+#define TEST_HEIGHT 2
+#define TEST_WIDTH 3
+#define SCREEN_HEIGHT 8
+#define SCREEN_WIDTH 21
+
+char testSymbols[] = "ABACBC";
+
+// the cards as they're dealt
+const char *startFrame[SCREEN_HEIGHT] = {
+    "                     ",
+    "  +---+ +---+ +---+  ",
+    "  | A | | B | | A |  ",
+    "  +---+ +---+ +---+  ",
+    "  +---+ +---+ +---+  ",
+    "  | C | | B | | C |  ",
+    "  +---+ +---+ +---+  ",
+    "                     ",
+};
+
+// the A pair of the top row removed in difficult mode: the B between them slides to the left
+const char *slidFrame[SCREEN_HEIGHT] = {
+    "                     ",
+    "  +---+              ",
+    "  | B |              ",
+    "  +---+              ",
+    "  +---+ +---+ +---+  ",
+    "  | C | | B | | C |  ",
+    "  +---+ +---+ +---+  ",
+    "                     ",
+};
+
+// then the B pair: the last C of the bottom row slides next to the other one
+const char *lastFrame[SCREEN_HEIGHT] = {
+    "                     ",
+    "                     ",
+    "                     ",
+    "                     ",
+    "  +---+ +---+        ",
+    "  | C | | C |        ",
+    "  +---+ +---+        ",
+    "                     ",
+};
+
+// the A pair removed again, with the removed cards fading (anims.ms > 0): the B slid left,
+// the two A fade at the end of the row, where the cells are left empty
+const char *fadingFrame[SCREEN_HEIGHT] = {
+    "                     ",
+    "  +---+ +---+ +---+  ",
+    "  | B | | A | | A |  ",
+    "  +---+ +---+ +---+  ",
+    "  +---+ +---+ +---+  ",
+    "  | C | | B | | C |  ",
+    "  +---+ +---+ +---+  ",
+    "                     ",
+};
+
+// color of the symbols of the top row while they fade
+int fadingColors[TEST_WIDTH] = {0, 2, 2};
+
+int failures = 0;
+
+// the last frame against the expected lines
+void CheckFrame(BoardView &view, const char *name, const char **expected) {
+    FILE *file = tmpfile();
+    if (file == NULL) {
+        printf("FAIL %s: no temp file\n", name);
+        ++failures;
+        return;
+    }
+
+    DumpVirtualScreen(GetVirtualScreen(view.display), file);
+    rewind(file);
+
+    char line[SCREEN_WIDTH + 2];
+
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        if (fgets(line, sizeof(line), file) == NULL) line[0] = '\0';
+        line[strcspn(line, "\n")] = '\0';
+
+        if (strcmp(line, expected[y]) == 0) continue;
+
+        printf("FAIL %s, line %d:\n  got      \"%s\"\n  expected \"%s\"\n", name, y, line, expected[y]);
+        ++failures;
+    }
+
+    fclose(file);
+}
+
+// color of the symbol of each card of row y in the last frame
+void CheckColors(BoardView &view, const char *name, int y, int *expected) {
+    for (int x = 0; x < TEST_WIDTH; x++) {
+        Rect rect = GetScreenRect(view, {y, x});
+        Cell cell = GetScreenCell(GetVirtualScreen(view.display), rect.y + 1, rect.x + 2);
+
+        if (cell.color == expected[x]) continue;
+
+        printf("FAIL %s, card (%d, %d): color %d, expected %d\n", name, y, x, cell.color, expected[x]);
+        ++failures;
+    }
+}
+
+void RemoveTestPair(Game<ArrayBoard> &game, BoardView &view, Pos p1, Pos p2) {
+    Pos pair[2] = {p1, p2};
+    Path path;
+
+    if (!CheckPair(game, pair, path)) {
+        printf("FAIL (%d, %d) (%d, %d) is not a pair\n", p1.y, p1.x, p2.y, p2.x);
+        ++failures;
+        return;
+    }
+
+    RemovePair(game, pair);
+    DrawFrame(view);
+    EndFrame(view, "input");
+}
+
+// the board as it's dealt, on a new view
+void StartTestGame(Game<ArrayBoard> &game, BoardView &view, int animationMs) {
+    LoadGame(game, TEST_HEIGHT, TEST_WIDTH, MODE_DIFFICULT, testSymbols);
+
+    CreateBoardView(view, TEST_HEIGHT, TEST_WIDTH, SCREEN_HEIGHT, SCREEN_WIDTH);
+    CreateVirtualScreen(view.display, view);
+    view.anims.ms = animationMs;
+
+    for (int i = 0; i < TEST_HEIGHT; i++) {
+        for (int j = 0; j < TEST_WIDTH; j++) DisplayCard(view, {i, j}, GetSymbol(game.board, {i, j}));
+    }
+
+    DrawFrame(view);
+    EndFrame(view, "start");
+
+    Subscribe(game, DrawGameEvent, &view);
+}
+
+int main() {
+    Game<ArrayBoard> game;
+    BoardView view;
+
+    // anims.ms is 0, removed cards are emptied at once
+    StartTestGame(game, view, 0);
+    CheckFrame(view, "start", startFrame);
+
+    RemoveTestPair(game, view, {0, 0}, {0, 2});
+    CheckFrame(view, "slid", slidFrame);
+
+    RemoveTestPair(game, view, {0, 0}, {1, 1});
+    CheckFrame(view, "last", lastFrame);
+
+    DeleteBoardView(view);
+    DeleteGame(game);
+
+    // the same with animations: the removed cards fade until their time is up
+    StartTestGame(game, view, 150);
+
+    RemoveTestPair(game, view, {0, 0}, {0, 2});
+    CheckFrame(view, "fading", fadingFrame);
+    CheckColors(view, "fading", 0, fadingColors);
+
+    FinishAnimations(view);
+    DrawFrame(view);
+    EndFrame(view, "animation");
+    CheckFrame(view, "faded", slidFrame);
+
+    DeleteBoardView(view);
+    DeleteGame(game);
+
+    if (failures > 0) return 1;
+
+    printf("ok: 5 frames match\n");
+    return 0;
+}